@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,13 @@ package com.sun.javafx.webkit.drt;
 import com.sun.javafx.application.PlatformImpl;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
+import com.sun.javafx.tk.RenderJob;
+import com.sun.javafx.tk.Toolkit;
+import com.sun.prism.Graphics;
+import com.sun.prism.GraphicsPipeline;
+import com.sun.prism.RTTexture;
+import com.sun.prism.ResourceFactory;
+import com.sun.prism.Texture;
 import com.sun.webkit.*;
 import com.sun.webkit.graphics.*;
 
@@ -48,6 +55,7 @@ import java.util.List;
 import java.util.Timer;
 import java.util.TimerTask;
 import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.FutureTask;
 import javafx.scene.web.WebEngine;
 
 public final class DumpRenderTree {
@@ -55,6 +63,13 @@ public final class DumpRenderTree {
     private final static long PID = (new Date()).getTime() & 0xFFFF;
     private final static String fileSep = System.getProperty("file.separator");
     private static boolean forceDumpAsText = false;
+    private static final int PAGE_WIDTH = 800;
+    private static final int PAGE_HEIGHT = 600;
+
+    // Perf mode: how many times each page is run, 0 when running layout tests,
+    // and how many frames are painted after the page has loaded.
+    private static int perfRuns = 0;
+    private static int perfFrames = 10;
 
     final static PrintWriter out;
     static {
@@ -77,6 +92,7 @@ public final class DumpRenderTree {
     private boolean loaded;
     private boolean waiting;
     private boolean complete;
+    private PerfReport perfReport;
 
     static class RenderUpdateHelper extends TimerTask {
         private WebPage webPage;
@@ -157,7 +173,7 @@ public final class DumpRenderTree {
                               new ThemeClientImplStub(), false);
         uiClient.setWebPage(webPage);
 
-        webPage.setBounds(0, 0, 800, 600);
+        webPage.setBounds(0, 0, PAGE_WIDTH, PAGE_HEIGHT);
         webPage.setDeveloperExtrasEnabled(true);
         webPage.addLoadListenerClient(new DRTLoadListener());
 
@@ -279,6 +295,10 @@ public final class DumpRenderTree {
         l.await();
         task.cancel();
         timer.cancel();
+        if (perfReport != null) {
+            perfReport.loaded();
+            paintFrames();
+        }
         final CountDownLatch latchForEvents = new CountDownLatch(1);
         Invoker.getInvoker().invokeOnEventThread(() -> {
             mlog("dispose");
@@ -289,6 +309,63 @@ public final class DumpRenderTree {
         latchForEvents.await();
     }
 
+    private void runPerfTest(final String testString) throws Exception {
+        perfReport = new PerfReport(testString);
+        for (int i = 0; i < perfRuns; i++) {
+            perfReport.begin();
+            runTest(testString);
+            perfReport.end();
+        }
+        perfReport.print(out);
+        perfReport = null;
+    }
+
+    /*
+     * Paints the loaded page perfFrames times, letting CSS animations and
+     * timers advance in between, and decodes each frame into an offscreen
+     * texture the way WebView does on the screen.
+     */
+    private void paintFrames() throws Exception {
+        for (int i = 0; i < perfFrames; i++) {
+            final CountDownLatch repainted = new CountDownLatch(1);
+            Invoker.getInvoker().invokeOnEventThread(() -> {
+                webPage.forceRepaint();
+                repainted.countDown();
+            });
+            repainted.await();
+
+            FutureTask<Void> f = new FutureTask<>(this::paintOffscreen, null);
+            Toolkit.getToolkit().addRenderJob(new RenderJob(f));
+            f.get();
+            Thread.sleep(1000 / 60);
+        }
+    }
+
+    // called on the Render thread
+    private void paintOffscreen() {
+        ResourceFactory factory = GraphicsPipeline.getDefaultResourceFactory();
+        if (factory == null || factory.isDisposed()) {
+            mlog("paintOffscreen: device disposed or not ready");
+            return;
+        }
+        RTTexture texture = factory.createRTTexture(PAGE_WIDTH, PAGE_HEIGHT,
+                Texture.WrapMode.CLAMP_NOT_NEEDED);
+        try {
+            Graphics g = texture.createGraphics();
+            g.setCamera(WCCamera.INSTANCE);
+            WCGraphicsContext gc = WCGraphicsManager.getGraphicsManager()
+                    .createGraphicsContext(g);
+            try {
+                webPage.paint(gc, 0, 0, PAGE_WIDTH, PAGE_HEIGHT);
+                gc.flush();
+            } finally {
+                gc.dispose();
+            }
+        } finally {
+            texture.dispose();
+        }
+    }
+
     // called from native
     private static void waitUntilDone() {
         mlog("waitUntilDone");
@@ -368,6 +445,12 @@ public final class DumpRenderTree {
         if (waiting || !loaded || complete) {
             return;
         }
+        if (perfRuns > 0) {
+            // Nothing to compare, the page is only timed
+            complete = true;
+            this.latch.countDown();
+            return;
+        }
         mlog("dump");
         dump(webPage.getMainFrame());
 
@@ -460,17 +543,23 @@ public final class DumpRenderTree {
         for (String arg: args) {
             if ("--dump-as-text".equals(arg)) {
                 forceDumpAsText = true;
+            } else if ("--perf".equals(arg)) {
+                perfRuns = 5;
+            } else if (arg.startsWith("--perf=")) {
+                perfRuns = Integer.parseInt(arg.substring("--perf=".length()));
+            } else if (arg.startsWith("--perf-frames=")) {
+                perfFrames = Integer.parseInt(arg.substring("--perf-frames=".length()));
             } else if ("-".equals(arg)) {
                 // read from stdin
                 BufferedReader in = new BufferedReader(
                         new InputStreamReader(System.in));
                 String testPath;
                 while ((testPath = in.readLine()) != null) {
-                    drt.runTest(testPath);
+                    drt.runPage(testPath);
                 }
                 in.close();
             } else {
-                drt.runTest(arg);
+                drt.runPage(arg);
             }
         }
         PlatformImpl.exit();
@@ -478,6 +567,22 @@ public final class DumpRenderTree {
         System.exit(0); // workaround to kill media threads
     }
 
+    /*
+     * Runs a layout test or, in perf mode, times a page. The perf mode loads
+     * each page --perf=N times (5 by default) and paints --perf-frames=N
+     * frames after each load, then prints the medians. It needs no screen
+     * or GPU when started with
+     *     -Dglass.platform=Monocle -Dmonocle.platform=Headless -Dprism.order=sw
+     * A corpus of pages is in tests/performance/webLoad/drt.
+     */
+    private void runPage(final String testString) throws Exception {
+        if (perfRuns > 0) {
+            runPerfTest(testString);
+        } else {
+            runTest(testString);
+        }
+    }
+
     // called from native
     private static int getWorkerThreadCount() {
         return WebPage.getWorkerThreadCount();
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.javafx.webkit.drt;
+
+import com.sun.webkit.WebPage;
+import com.sun.webkit.perf.PerfCounters;
+import java.io.File;
+import java.io.PrintWriter;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.Map;
+import java.util.TreeMap;
+
+/*
+ * Collects the timings of the runs of one page in the perf mode of
+ * DumpRenderTree and prints their medians as one row of a table.
+ *
+ * The native times come from the WTF::PerfCounters timers: Parse is the
+ * HTML tokenizer and tree builder, Paint is WebKit painting into the
+ * RenderingQueue. Decode is the java side replaying the queue into an
+ * offscreen texture, which is reported along with the native counters.
+ */
+final class PerfReport {
+    private static final String[] COLUMNS = {
+        "load(ms)", "parse(ms)", "style(ms)", "layout(ms)", "paint(ms)",
+        "rq(KB)", "decode(ms)", "jni"
+    };
+    private static boolean headerPrinted;
+
+    private final String name;
+    private final List<long[]> runs = new ArrayList<>();
+    private final Map<String,List<Long>> callSites = new TreeMap<>();
+
+    private PerfCounters countersBefore;
+    private long start;
+    private long loadNanos;
+
+    PerfReport(String testPath) {
+        this.name = new File(testPath).getName();
+        WebPage.setPerfCountersEnabled(true);
+    }
+
+    void begin() {
+        countersBefore = WebPage.getPerfCounters();
+        start = System.nanoTime();
+    }
+
+    void loaded() {
+        loadNanos = System.nanoTime() - start;
+    }
+
+    void end() {
+        PerfCounters delta = WebPage.getPerfCounters().since(countersBefore);
+
+        long jniCalls = 0;
+        for (String site : delta.getCallSiteNames()) {
+            long count = delta.getCount(site);
+            jniCalls += count;
+            callSites.computeIfAbsent(site, k -> new ArrayList<>()).add(count);
+        }
+        runs.add(new long[] {
+            loadNanos,
+            delta.getTotalTime("Parse"),
+            delta.getTotalTime("StyleRecalc"),
+            delta.getTotalTime("Layout"),
+            delta.getTotalTime("Paint"),
+            delta.getCount("RenderingQueue.bytes"),
+            delta.getTotalTime("Decode"),
+            jniCalls
+        });
+    }
+
+    void print(PrintWriter out) {
+        if (!headerPrinted) {
+            out.printf("%-32s", "page");
+            for (String column : COLUMNS) {
+                out.printf(" %10s", column);
+            }
+            out.print('\n');
+            headerPrinted = true;
+        }
+        out.printf("%-32s", name);
+        for (int i = 0; i < COLUMNS.length; i++) {
+            final int column = i;
+            long value = median(runs.stream().mapToLong(r -> r[column]).toArray());
+            switch (column) {
+                case 5:
+                    out.printf(" %10d", value / 1024);
+                    break;
+                case 7:
+                    out.printf(" %10d", value);
+                    break;
+                default:
+                    out.printf(" %10.2f", value / 1e6);
+            }
+        }
+        out.print('\n');
+        for (Map.Entry<String,List<Long>> e : callSites.entrySet()) {
+            long count = median(e.getValue().stream().mapToLong(Long::longValue).toArray());
+            if (count > 0) {
+                out.printf("    %-50s %10d\n", e.getKey(), count);
+            }
+        }
+        out.flush();
+    }
+
+    private static long median(long[] values) {
+        if (values.length == 0) {
+            return 0;
+        }
+        Arrays.sort(values);
+        return values[values.length / 2];
+    }
+}
@@ -259,10 +259,10 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
         return pixelBuffer;
     }
 
-    // This method is called from native [ImageBufferData::update]
-    // while lazy painting procedure
+    // This method is called from native [ImageBufferJavaBackend::update]
+    // with the part of the pixel buffer that was modified
     @Override
-    protected void drawPixelBuffer() {
+    protected void drawPixelBuffer(int x, int y, int w, int h) {
         PrismInvoker.invokeOnRenderThread(new Runnable() {
             @Override
             public void run() {
@@ -274,10 +274,10 @@ final class RTImage extends PrismImage implements ResourceFactoryListener {
                     Image img = Image.fromByteBgraPreData(
                             pixelBuffer,
                             width,
-                            height);
+                            height).createSubImage(x, y, w, h);
                     Texture txt = g.getResourceFactory().createTexture(img, Texture.Usage.DEFAULT, Texture.WrapMode.CLAMP_NOT_NEEDED);
-                    g.clear();
-                    g.drawTexture(txt, 0, 0, width, height);
+                    g.clearQuad(x, y, x + w, y + h);
+                    g.drawTexture(txt, x, y, x + w, y + h, 0, 0, w, h);
                     txt.dispose();
                 }
             }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -115,6 +115,27 @@ final class WCFontImpl extends WCFont {
         return new float[]{bb[0], -bb[3], bb[2], bb[3] - bb[1]};
     }
 
+    @Override public void getGlyphWidths(int firstGlyph, float[] widths) {
+        FontResource fr = getFontStrike().getFontResource();
+        float size = font.getSize();
+        for (int i = 0; i < widths.length; i++) {
+            widths[i] = fr.getAdvance(firstGlyph + i, size);
+        }
+    }
+
+    @Override public void getGlyphBoundingBoxes(int firstGlyph, float[] boxes) {
+        FontResource fr = getFontStrike().getFontResource();
+        float size = font.getSize();
+        float[] bb = new float[4];
+        for (int i = 0; i < boxes.length / 4; i++) {
+            bb = fr.getGlyphBoundingBox(firstGlyph + i, size, bb);
+            boxes[4 * i] = bb[0];
+            boxes[4 * i + 1] = -bb[3];
+            boxes[4 * i + 2] = bb[2];
+            boxes[4 * i + 3] = bb[3] - bb[1];
+        }
+    }
+
     @Override public float getXHeight() {
         return getFontStrike().getMetrics().getXHeight();
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,9 +41,15 @@ import java.io.ByteArrayInputStream;
 import java.io.IOException;
 import java.io.InputStream;
 import java.util.Arrays;
+import javafx.application.Platform;
 import javafx.concurrent.Service;
 import javafx.concurrent.Task;
 
+/*
+ * The decoder is called from the event thread, which adds the data, and from
+ * the threads WebCore decodes frames on, as well as from the loader service.
+ * All of its state is guarded by the decoder itself.
+ */
 final class WCImageDecoderImpl extends WCImageDecoder {
 
     private final static PlatformLogger log;
@@ -57,8 +63,9 @@ final class WCImageDecoderImpl extends WCImageDecoder {
     private boolean fullDataReceived = false;
     private boolean framesDecoded = false; // guards frames from repeated decoding
     private PrismImage[] images;
-    private volatile byte[] data;
-    private volatile int dataSize = 0;
+    private PrismImage scaledImage; // single frame decoded at a reduced size
+    private byte[] data;
+    private int dataSize = 0;
     private String fileNameExtension;
 
     static {
@@ -79,10 +86,11 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         destroyLoader();
         frames = null;
         images = null;
+        scaledImage = null;
         framesDecoded = false;
     }
 
-    @Override protected String getFilenameExtension() {
+    @Override protected synchronized String getFilenameExtension() {
         return "." + fileNameExtension;
     }
 
@@ -90,7 +98,12 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return imageWidth > 0 && imageHeight > 0;
     }
 
-    @Override protected void addImageData(byte[] dataPortion) {
+    // GIF is the only supported format that can hold more than one frame.
+    private boolean isSingleFrameFormat() {
+        return fileNameExtension != null && !"gif".equalsIgnoreCase(fileNameExtension);
+    }
+
+    @Override protected synchronized void addImageData(byte[] dataPortion) {
         if (dataPortion != null) {
             fullDataReceived = false;
             if (data == null) {
@@ -173,12 +186,17 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         setFrames(loadFrames(in));
     }
 
-    private synchronized ImageFrame[] loadFrames(InputStream in) {
+    private ImageFrame[] loadFrames(InputStream in) {
+        return loadFrames(in, 0, 0);
+    }
+
+    private synchronized ImageFrame[] loadFrames(InputStream in, int width, int height) {
         if (log.isLoggable(Level.FINE)) {
-            log.fine(String.format("%X Decoding frames", hashCode()));
+            log.fine(String.format("%X Decoding frames (%dx%d)", hashCode(), width, height));
         }
         try {
-            return ImageStorage.getInstance().loadAll(in, readerListener, 0, 0, true, 1.0f, false);
+            boolean scaled = width > 0 && height > 0;
+            return ImageStorage.getInstance().loadAll(in, readerListener, width, height, !scaled, 1.0f, scaled);
         } catch (ImageStorageException e) {
             return null; // consider image missing
         } finally {
@@ -190,7 +208,7 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         }
     }
 
-    private ImageFrame[] loadFrames() {
+    private synchronized ImageFrame[] loadFrames() {
         return loadFrames(new ByteArrayInputStream(this.data, 0, this.dataSize));
     }
 
@@ -216,7 +234,7 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         }
     };
 
-    @Override protected int[] getImageSize() {
+    @Override protected synchronized int[] getImageSize() {
         final int[] size = THREAD_LOCAL_SIZE_ARRAY.get();
         size[0] = imageWidth;
         size[1] = imageHeight;
@@ -256,7 +274,12 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         frameCount = frames == null ? 0 : frames.length;
     }
 
-    @Override protected int getFrameCount() {
+    @Override protected synchronized int getFrameCount() {
+        // Single frame formats do not need to be decoded to be counted,
+        // which leaves the decoding to the thread that asks for the frame.
+        if (fullDataReceived && imageSizeAvilable() && isSingleFrameFormat()) {
+            return 1;
+        }
         // Initiate full decode to get frame count.
         // NOTE: This method will be called just before
         // rendering the given image, so there will not
@@ -270,7 +293,15 @@ final class WCImageDecoderImpl extends WCImageDecoder {
 
     // Avoid redundant decoding by async decoder threads, currently we don't
     // support per frame decoding.
-    @Override protected synchronized WCImageFrame getFrame(int idx) {
+    @Override protected synchronized WCImageFrame getFrame(int idx, int width, int height) {
+        if (idx == 0 && width > 0 && height > 0
+                && (width != imageWidth || height != imageHeight)
+                && fullDataReceived && isSingleFrameFormat()) {
+            PrismImage img = getScaledImage(width, height);
+            if (img != null) {
+                return new Frame(img, fileNameExtension);
+            }
+        }
         ImageFrame frame = getImageFrame(idx);
         if (frame != null) {
             if (log.isLoggable(Level.FINE)) {
@@ -287,6 +318,21 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         return null;
     }
 
+    // Decodes the image straight to the requested size, so a large image
+    // drawn much smaller than its original size never exists at full size.
+    private synchronized PrismImage getScaledImage(int width, int height) {
+        if (scaledImage == null
+                || scaledImage.getWidth() != width
+                || scaledImage.getHeight() != height) {
+            ImageFrame[] scaledFrames = loadFrames(
+                    new ByteArrayInputStream(this.data, 0, this.dataSize), width, height);
+            scaledImage = scaledFrames != null && scaledFrames.length > 0 && scaledFrames[0] != null
+                    ? new WCImageImpl(scaledFrames[0])
+                    : null;
+        }
+        return scaledImage;
+    }
+
     private synchronized ImageMetadata getFrameMetadata(int idx) {
         return frames != null && frames.length > idx && frames[idx] != null ? frames[idx].getMetadata() : null;
     }
@@ -308,10 +354,10 @@ final class WCImageDecoderImpl extends WCImageDecoder {
             }
     };
 
-    @Override protected int[] getFrameSize(int idx) {
+    @Override protected synchronized int[] getFrameSize(int idx) {
         final ImageMetadata meta = getFrameMetadata(idx);
         if (meta == null) {
-            return null;
+            return hasScaledImage(idx) ? getImageSize() : null;
         }
         final int[] size = THREAD_LOCAL_SIZE_ARRAY.get();
         size[0] = meta.imageWidth;
@@ -323,12 +369,20 @@ final class WCImageDecoderImpl extends WCImageDecoder {
         // For GIF images there is no better way to find whether a given frame
         // is completely decoded or not. As of now relying on framesDecoded
         // which will wait for all the frames to decode.
-        return getFrameMetadata(idx) != null && framesDecoded;
+        return (getFrameMetadata(idx) != null && framesDecoded) || hasScaledImage(idx);
+    }
+
+    private synchronized boolean hasScaledImage(int idx) {
+        return idx == 0 && scaledImage != null;
     }
 
     private synchronized ImageFrame getImageFrame(int idx) {
         if (!fullDataReceived) {
-            startLoader();
+            // The loader service can only be driven from the event thread;
+            // a decoding thread gets whatever has been decoded so far.
+            if (Platform.isFxApplicationThread()) {
+                startLoader();
+            }
         } else if (fullDataReceived && !framesDecoded) {
             destroyLoader();
             setFrames(loadFrames()); // re-decode frames if they have been destroyed
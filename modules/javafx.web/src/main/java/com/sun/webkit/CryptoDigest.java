@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit;
+
+/**
+ * Computes a digest with the native PAL::CryptoDigest, which WebCore uses
+ * for subresource integrity, CSP hashes and WebSocket handshakes.
+ */
+final class CryptoDigest {
+
+    private long nativePointer;
+
+
+    /**
+     * Creates a digest for one of "SHA-1", "SHA-224", "SHA-256", "SHA-384"
+     * or "SHA-512".
+     */
+    CryptoDigest(String algorithm) {
+        if (algorithm == null) {
+            throw new NullPointerException("algorithm is null");
+        }
+        this.nativePointer = twkCreate(algorithm);
+        if (nativePointer == 0) {
+            throw new IllegalArgumentException(
+                    "unsupported algorithm: " + algorithm);
+        }
+    }
+
+    void addBytes(byte[] buffer, int offset, int length) {
+        if (nativePointer == 0) {
+            throw new IllegalStateException("nativePointer is 0");
+        }
+        if (buffer == null) {
+            throw new NullPointerException("buffer is null");
+        }
+        if (offset < 0) {
+            throw new IndexOutOfBoundsException("offset is negative");
+        }
+        if (length < 0) {
+            throw new IndexOutOfBoundsException("length is negative");
+        }
+        if (length > buffer.length - offset) {
+            throw new IndexOutOfBoundsException(
+                    "length is greater than buffer.length - offset");
+        }
+        twkAddBytes(nativePointer, buffer, offset, length);
+    }
+
+    /**
+     * Returns the digest of the bytes added so far and disposes of the
+     * native digest.
+     */
+    byte[] computeHash() {
+        if (nativePointer == 0) {
+            throw new IllegalStateException("nativePointer is 0");
+        }
+        try {
+            return twkComputeHash(nativePointer);
+        } finally {
+            twkDispose(nativePointer);
+            nativePointer = 0;
+        }
+    }
+
+    private static native long twkCreate(String algorithm);
+
+    private static native void twkAddBytes(long nativePointer,
+                                           byte[] buffer,
+                                           int offset,
+                                           int length);
+
+    private static native byte[] twkComputeHash(long nativePointer);
+
+    private static native void twkDispose(long nativePointer);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2016, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,44 +23,21 @@
  * questions.
  */
 
-#include "config.h"
-#include "RunLoop.h"
+package com.sun.webkit;
 
-namespace WTF {
-
-// JDK-8146878
-//XXX: implement these stubs?
-
-RunLoop::RunLoop() {}
-RunLoop::~RunLoop() {}
-
-void RunLoop::TimerBase::fired() {}
-
-void RunLoop::run() {}
-void RunLoop::stop() {}
-void RunLoop::wakeUp() {}
-
-RunLoop::TimerBase::TimerBase(RunLoop& runLoop)
-    : m_runLoop(runLoop)
-{
-}
-
-RunLoop::TimerBase::~TimerBase()
-{
-    stop();
-}
-
-void RunLoop::TimerBase::start(double fireInterval, bool repeat)
-{
-}
-
-void RunLoop::TimerBase::stop()
-{
-}
-
-bool RunLoop::TimerBase::isActive() const
-{
-  return true;
+/**
+ * Decides which local files WebKit may open, for the embedder to restrict
+ * access beyond the defaults.
+ *
+ * @see WebPage#setFileAccessPolicy(FileAccessPolicy)
+ */
+@FunctionalInterface
+public interface FileAccessPolicy {
+
+    /**
+     * Returns whether WebKit may open the file at the given path, for
+     * writing if {@code write} is {@code true}, or else for reading and
+     * mapping. May be called on any thread that uses the file system.
+     */
+    boolean canOpen(String path, boolean write);
 }
-
-} // namespace WTF
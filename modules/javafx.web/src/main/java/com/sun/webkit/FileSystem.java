@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,7 +35,9 @@ import java.nio.ByteBuffer;
 import java.nio.channels.FileChannel;
 import java.nio.file.Files;
 import java.nio.file.InvalidPathException;
+import java.nio.file.Path;
 import java.nio.file.Paths;
+import java.nio.file.StandardCopyOption;
 
 final class FileSystem {
 
@@ -47,6 +49,15 @@ final class FileSystem {
     private final static PlatformLogger logger =
             PlatformLogger.getLogger(FileSystem.class.getName());
 
+    // Whether native code may open files for writing
+    private static final boolean ALLOW_WRITE =
+            Boolean.getBoolean("com.sun.webkit.allowFileWrite");
+
+    // The directory native code may write to regardless of ALLOW_WRITE
+    private static volatile Path writableDirectory;
+
+    // Set by the embedder through WebPage.setFileAccessPolicy
+    private static volatile FileAccessPolicy accessPolicy;
 
     private FileSystem() {
         throw new AssertionError();
@@ -57,6 +68,9 @@ final class FileSystem {
     }
 
     private static RandomAccessFile fwkOpenFile(String path, String mode) {
+        if (!canOpenFile(path, !"r".equals(mode))) {
+            return null;
+        }
         try {
             return new RandomAccessFile(path, mode);
         } catch (FileNotFoundException | SecurityException ex) {
@@ -65,6 +79,94 @@ final class FileSystem {
         return null;
     }
 
+    /**
+     * Decides whether native code may open the file at the given path, on
+     * the platforms where files are read and mapped natively rather than
+     * through {@link #fwkOpenFile}.
+     */
+    private static boolean fwkCanOpenFile(String path, boolean write) {
+        return canOpenFile(path, write);
+    }
+
+    /*
+     * Writes are only allowed when com.sun.webkit.allowFileWrite is set or
+     * in the writable directory. The embedder policy, if any, can then still
+     * deny any access.
+     */
+    private static boolean canOpenFile(String path, boolean write) {
+        if (write && !ALLOW_WRITE && !isInWritableDirectory(path)) {
+            logger.fine(format("Write access denied for file [%s]", path));
+            return false;
+        }
+        FileAccessPolicy policy = accessPolicy;
+        if (policy != null && !policy.canOpen(path, write)) {
+            logger.fine(format("Access denied by the policy for file [%s]", path));
+            return false;
+        }
+        return true;
+    }
+
+    static void setAccessPolicy(FileAccessPolicy policy) {
+        accessPolicy = policy;
+    }
+
+    /**
+     * Allows native code to write files in the given directory,
+     * or revokes that when {@code directory} is {@code null}.
+     */
+    static void setWritableDirectory(String directory) {
+        try {
+            writableDirectory = directory != null
+                    ? Paths.get(directory).toAbsolutePath().normalize()
+                    : null;
+        } catch (InvalidPathException ex) {
+            logger.fine(format("Invalid writable directory [%s]", directory), ex);
+            writableDirectory = null;
+        }
+    }
+
+    private static boolean isInWritableDirectory(String path) {
+        Path directory = writableDirectory;
+        if (directory == null) {
+            return false;
+        }
+        try {
+            Path realDirectory = realPath(directory);
+            Path realPath = realPath(Paths.get(path));
+            return realDirectory != null && realPath != null
+                    && realPath.startsWith(realDirectory);
+        } catch (InvalidPathException ex) {
+            return false;
+        }
+    }
+
+    /**
+     * Returns the path with all symbolic links resolved. The file itself and
+     * any of its parents need not exist yet, but the part that does not
+     * exist must not step out of the part that does; {@code null} is
+     * returned otherwise or if the path cannot be resolved.
+     */
+    private static Path realPath(Path path) {
+        Path existing = path.toAbsolutePath();
+        Path rest = existing.getFileSystem().getPath("");
+        while (existing != null && !Files.exists(existing)) {
+            Path name = existing.getFileName();
+            if (name == null || name.toString().equals("..")) {
+                return null;
+            }
+            rest = name.resolve(rest);
+            existing = existing.getParent();
+        }
+        if (existing == null) {
+            return null;
+        }
+        try {
+            return existing.toRealPath().resolve(rest).normalize();
+        } catch (IOException ex) {
+            return null;
+        }
+    }
+
     private static void fwkCloseFile(RandomAccessFile raf) {
         try {
             raf.close();
@@ -140,6 +242,46 @@ final class FileSystem {
         }
     }
 
+    private static String[] fwkListDirectory(String path) {
+        if (!canOpenFile(path, false)) {
+            return null;
+        }
+        try {
+            return new File(path).list();
+        } catch (SecurityException ex) {
+            logger.fine(format("Error listing directory [%s]", path), ex);
+            return null;
+        }
+    }
+
+    private static boolean fwkDeleteFile(String path) {
+        if (!canOpenFile(path, true)) {
+            return false;
+        }
+        try {
+            File file = new File(path);
+            return file.isFile() && file.delete();
+        } catch (SecurityException ex) {
+            logger.fine(format("Error deleting file [%s]", path), ex);
+            return false;
+        }
+    }
+
+    private static boolean fwkMoveFile(String oldPath, String newPath) {
+        if (!canOpenFile(oldPath, true) || !canOpenFile(newPath, true)) {
+            return false;
+        }
+        try {
+            Files.move(Paths.get(oldPath), Paths.get(newPath),
+                    StandardCopyOption.REPLACE_EXISTING,
+                    StandardCopyOption.ATOMIC_MOVE);
+            return true;
+        } catch (InvalidPathException|IOException|SecurityException ex) {
+            logger.fine(format("Error moving file [%s] to [%s]", oldPath, newPath), ex);
+            return false;
+        }
+    }
+
     private static String fwkPathGetFileName(String path) {
         return new File(path).getName();
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,17 +25,74 @@
 
 package com.sun.webkit;
 
+import java.util.TimerTask;
+
 /**
  * The class reflects the native webkit module.
  */
 final class MainThread {
 
+    private static java.util.Timer dispatchTimer;
+    private static TimerTask pendingDispatch;
+    private static long pendingDeadline;
+    private static final long MAX_DELAY_MILLIS = 24 * 60 * 60 * 1000;
+
     private static void fwkScheduleDispatchFunctions() {
         Invoker.getInvoker().postOnEventThread(() -> {
             twkScheduleDispatchFunctions();
         });
     }
 
+    /**
+     * Schedules the dispatch after the given delay, unless an earlier one
+     * is already pending. Used to fire the main run loop timers; the wake-ups
+     * may be requested from several threads in any order.
+     *
+     * @param delay time to wait in seconds
+     */
+    private static synchronized void fwkScheduleDispatchFunctionsAfter(double delay) {
+        // Far off (or infinite) delays are cut short; the dispatch then
+        // finds no timer due and asks for the next wake-up again.
+        long millis = delay > 0
+                ? (long) Math.ceil(Math.min(delay * 1000, MAX_DELAY_MILLIS))
+                : 0;
+        long deadline = System.nanoTime() + millis * 1_000_000L;
+        if (pendingDispatch != null && pendingDeadline - deadline <= 0) {
+            return;
+        }
+        if (millis == 0) {
+            cancelPendingDispatch();
+            fwkScheduleDispatchFunctions();
+            return;
+        }
+        if (dispatchTimer == null) {
+            dispatchTimer = new java.util.Timer("WebKit-RunLoop-Timer", true);
+        }
+        TimerTask dispatch = new TimerTask() {
+            @Override
+            public void run() {
+                synchronized (MainThread.class) {
+                    if (pendingDispatch == this) {
+                        pendingDispatch = null;
+                    }
+                }
+                fwkScheduleDispatchFunctions();
+            }
+        };
+        // Only a wake-up that is actually scheduled may hold off later ones.
+        dispatchTimer.schedule(dispatch, millis);
+        cancelPendingDispatch();
+        pendingDispatch = dispatch;
+        pendingDeadline = deadline;
+    }
+
+    private static void cancelPendingDispatch() {
+        if (pendingDispatch != null) {
+            pendingDispatch.cancel();
+            pendingDispatch = null;
+        }
+    }
+
     private static native void twkScheduleDispatchFunctions();
     static native void twkSetShutdown(boolean isShutdown);
 }
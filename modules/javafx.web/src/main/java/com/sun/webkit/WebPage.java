@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,6 +39,7 @@ import com.sun.webkit.event.WCMouseEvent;
 import com.sun.webkit.event.WCMouseWheelEvent;
 import com.sun.webkit.graphics.*;
 import com.sun.webkit.network.CookieManager;
+import com.sun.webkit.perf.PerfCounters;
 import static com.sun.webkit.network.URLs.newURL;
 import java.net.CookieHandler;
 import java.net.MalformedURLException;
@@ -82,6 +83,8 @@ public final class WebPage {
 
     private static final int MAX_FRAME_QUEUE_SIZE = 10;
     private static final int DEFAULT_BACKGROUND_INT_RGBA = 0xFFFFFFFF; // Color.WHITE
+    private static final long BYTECODE_CACHE_SIZE =
+            Long.getLong("com.sun.webkit.bytecodeCacheSize", 32L << 20);
 
     // Native WebPage* pointer
     private long pPage = 0;
@@ -141,16 +144,37 @@ public final class WebPage {
 
         final boolean useJIT = Boolean.valueOf(System.getProperty(
                 "com.sun.webkit.useJIT", "true"));
+        // The optimizing tiers are opt-in. FTL is only used where it is
+        // built and runs on top of the DFG tier, so opting in to FTL also
+        // turns on DFG unless that is disabled explicitly.
+        final boolean useFTLJIT = Boolean.valueOf(System.getProperty(
+                "com.sun.webkit.useFTLJIT", "false"));
         final boolean useDFGJIT = Boolean.valueOf(System.getProperty(
-                "com.sun.webkit.useDFGJIT", "false"));
+                "com.sun.webkit.useDFGJIT", String.valueOf(useFTLJIT)));
+        // WebAssembly is only available where it is built. Fast memories
+        // reserve several GB of address space per instance and rely on
+        // SIGSEGV handling, so bounds checked memories are used by default
+        // inside the JVM.
+        final boolean useWebAssembly = Boolean.valueOf(System.getProperty(
+                "com.sun.webkit.useWebAssembly", "true"));
+        final boolean useWasmFastMemory = Boolean.valueOf(System.getProperty(
+                "com.sun.webkit.useWasmFastMemory", "false"));
 
         // TODO: Enable CSS3D by default once it is stabilized.
         boolean useCSS3D = Boolean.valueOf(System.getProperty(
                 "com.sun.webkit.useCSS3D", "false"));
         useCSS3D = useCSS3D && Platform.isSupported(ConditionalFeature.SCENE3D);
+        // The size of the tiles composited layers are painted into.
+        final int compositingTileSize = Integer.getInteger(
+                "com.sun.webkit.compositingTileSize", 512);
 
         // Initialize WTF, WebCore and JavaScriptCore.
-        twkInitWebCore(useJIT, useDFGJIT, useCSS3D);
+        twkInitWebCore(useJIT, useDFGJIT, useFTLJIT, useWebAssembly,
+                useWasmFastMemory, useCSS3D, compositingTileSize);
+
+        if (Boolean.getBoolean("com.sun.webkit.perfCounters")) {
+            setPerfCountersEnabled(true);
+        }
 
         // Inform the native webkit code when either the JVM or the
         // JavaFX runtime is being shutdown
@@ -238,6 +262,8 @@ public final class WebPage {
 
     private WCPageBackBuffer backbuffer;
     private List<WCRectangle> dirtyRects = new LinkedList<>();
+    // A frame is needed even though nothing is dirty
+    private boolean frameRequested;
 
     private void addDirtyRect(WCRectangle toPaint) {
         if (toPaint.getWidth() <= 0 || toPaint.getHeight() <= 0) {
@@ -271,7 +297,7 @@ public final class WebPage {
     public boolean isDirty() {
         lockPage();
         try {
-            return !dirtyRects.isEmpty();
+            return !dirtyRects.isEmpty() || frameRequested;
         } finally {
             unlockPage();
         }
@@ -283,6 +309,7 @@ public final class WebPage {
                     new Object[] {dirtyRects, currentFrame});
         }
 
+        frameRequested = false;
         if (isDisposed || width <= 0 || height <= 0) {
             // If there're any dirty rects left, they are invalid.
             // Clear the list so that the platform doesn't consider
@@ -2071,6 +2098,65 @@ public final class WebPage {
         }
     }
 
+    /**
+     * Sets the policy that decides which local files WebKit may open, for
+     * all pages. The policy can deny reads as well as writes, but cannot
+     * allow writes the defaults forbid. A {@code null} policy allows
+     * everything the defaults allow.
+     */
+    public static void setFileAccessPolicy(FileAccessPolicy policy) {
+        FileSystem.setAccessPolicy(policy);
+    }
+
+    /**
+     * Enables the on-disk cache of the bytecode generated for external
+     * scripts, stored in the given directory and limited to
+     * {@code com.sun.webkit.bytecodeCacheSize} bytes (32 MB by default).
+     * The cache is shared by all pages and is disabled when
+     * {@code directory} is {@code null}.
+     */
+    public static void setBytecodeCacheDirectory(String directory) {
+        setBytecodeCacheDirectory(directory, BYTECODE_CACHE_SIZE);
+    }
+
+    /**
+     * Enables the on-disk cache of the bytecode generated for external
+     * scripts, stored in the given directory. Once the cache holds more
+     * than {@code maxSize} bytes, its least recently written entries are
+     * deleted.
+     */
+    public static void setBytecodeCacheDirectory(String directory, long maxSize) {
+        Invoker.getInvoker().checkEventThread();
+        if (maxSize < 0) {
+            throw new IllegalArgumentException("maxSize: " + maxSize);
+        }
+        FileSystem.setWritableDirectory(directory);
+        twkSetBytecodeCacheDirectory(directory, maxSize);
+    }
+
+    /**
+     * Returns a snapshot of the native performance counters, along with the
+     * render queue decoding done on the java side. The counters are
+     * accumulated without locking, so the snapshot can be taken on any
+     * thread. Nothing is counted while the counters are
+     * disabled, see {@link #setPerfCountersEnabled(boolean)}.
+     */
+    public static PerfCounters getPerfCounters() {
+        PerfCounters counters = twkGetPerfCounters();
+        return counters != null
+                ? WCRenderQueue.addDecodeCounters(counters)
+                : null;
+    }
+
+    /**
+     * Turns the collection of the performance counters on or off. They are
+     * off unless the {@code com.sun.webkit.perfCounters} property is set.
+     */
+    public static void setPerfCountersEnabled(boolean enabled) {
+        PerfCounters.setEnabled(enabled);
+        twkSetPerfCountersEnabled(enabled);
+    }
+
     public void setLocalStorageEnabled(boolean enabled) {
         lockPage();
         try {
@@ -2150,6 +2236,16 @@ public final class WebPage {
         }
     }
 
+    private void fwkScheduleFrame() {
+        lockPage();
+        try {
+            paintLog.finest("Frame requested");
+            frameRequested = true;
+        } finally {
+            unlockPage();
+        }
+    }
+
     private void fwkScroll(int x, int y, int w, int h, int deltaX, int deltaY) {
         if (paintLog.isLoggable(Level.FINEST)) {
             paintLog.finest("Scroll: " + x + " " + y + " " + w + " " + h + "  " + deltaX + " " + deltaY);
@@ -2594,7 +2690,9 @@ public final class WebPage {
     // Native methods
     // *************************************************************************
 
-    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT, boolean useCSS3D);
+    private static native void twkInitWebCore(boolean useJIT, boolean useDFGJIT,
+            boolean useFTLJIT, boolean useWebAssembly, boolean useWasmFastMemory,
+            boolean useCSS3D, int compositingTileSize);
     private native long twkCreatePage(boolean editable);
     private native void twkInit(long pPage, boolean usePlugins, float devicePixelScale);
     private native void twkDestroyPage(long pPage);
@@ -2716,6 +2814,9 @@ public final class WebPage {
     private native void twkSetUserAgent(long page, String userAgent);
     private native void twkSetLocalStorageDatabasePath(long page, String path);
     private native void twkSetLocalStorageEnabled(long page, boolean enabled);
+    private static native void twkSetBytecodeCacheDirectory(String directory, long maxSize);
+    private static native void twkSetPerfCountersEnabled(boolean enabled);
+    private static native PerfCounters twkGetPerfCounters();
 
     private native int twkGetUnloadEventListenersCount(long pFrame);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -86,6 +86,7 @@ public final class GraphicsDecoder  {
     @Native public final static int SET_MITER_LIMIT        = 54;
     @Native public final static int SET_TEXT_MODE          = 55;
     @Native public final static int SET_PERSPECTIVE_TRANSFORM = 56;
+    @Native public final static int DRAWSTRING_INLINE      = 57;
 
     private final static PlatformLogger log =
             PlatformLogger.getLogger(GraphicsDecoder.class.getName());
@@ -100,302 +101,371 @@ public final class GraphicsDecoder  {
 
         ByteBuffer buf = bdata.getBuffer();
         buf.order(ByteOrder.nativeOrder());
+        long[][] profile = bdata.getProfile();
         while (buf.remaining() > 0) {
             int op = buf.getInt();
-            switch(op) {
-                case FILLRECT_FFFF:
-                    gc.fillRect(
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        null);
-                    break;
-                case FILLRECT_FFFFI:
-                    gc.fillRect(
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        getColor(buf));
-                    break;
-                case FILL_ROUNDED_RECT:
-                    gc.fillRoundedRect(
-                        // base rectangle
+            if (profile == null || op < 0 || op >= profile.length) {
+                decode(gm, gc, bdata, buf, op);
+                continue;
+            }
+            // Replayed buffers: time every primitive, and go on past the ones
+            // whose referenced objects could not be recreated. Each opcode
+            // reads all of its arguments before it resolves and casts its
+            // references, so the stream stays in step when that fails.
+            long start = System.nanoTime();
+            try {
+                decode(gm, gc, bdata, buf, op);
+            } catch (RuntimeException e) {
+                profile[op][2]++;
+            }
+            profile[op][0]++;
+            profile[op][1] += System.nanoTime() - start;
+        }
+    }
+
+    private static void decode(WCGraphicsManager gm, WCGraphicsContext gc,
+            BufferData bdata, ByteBuffer buf, int op) {
+        switch(op) {
+            case FILLRECT_FFFF:
+                gc.fillRect(
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    null);
+                break;
+            case FILLRECT_FFFFI:
+                gc.fillRect(
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    getColor(buf));
+                break;
+            case FILL_ROUNDED_RECT:
+                gc.fillRoundedRect(
+                    // base rectangle
+                    buf.getFloat(), buf.getFloat(), buf.getFloat(), buf.getFloat(),
+                    // top corners w/h
+                    buf.getFloat(), buf.getFloat(), buf.getFloat(), buf.getFloat(),
+                    // bottom corners w/h
+                    buf.getFloat(), buf.getFloat(), buf.getFloat(), buf.getFloat(),
+                    getColor(buf));
+                break;
+            case CLEARRECT_FFFF:
+                gc.clearRect(
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat());
+                break;
+            case STROKERECT_FFFFF:
+                gc.strokeRect(
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat());
+                break;
+            case SETFILLCOLOR:
+                gc.setFillColor(getColor(buf));
+                break;
+            case SET_TEXT_MODE:
+                gc.setTextMode(getBoolean(buf), getBoolean(buf), getBoolean(buf));
+                break;
+            case SETSTROKESTYLE:
+                gc.setStrokeStyle(buf.getInt());
+                break;
+            case SETSTROKECOLOR:
+                gc.setStrokeColor(getColor(buf));
+                break;
+            case SETSTROKEWIDTH:
+                gc.setStrokeWidth(buf.getFloat());
+                break;
+            case SET_FILL_GRADIENT:
+                gc.setFillGradient(getGradient(gc, buf));
+                break;
+            case SET_STROKE_GRADIENT:
+                gc.setStrokeGradient(getGradient(gc, buf));
+                break;
+            case SET_LINE_DASH:
+                gc.setLineDash(buf.getFloat(), getFloatArray(buf));
+                break;
+            case SET_LINE_CAP:
+                gc.setLineCap(buf.getInt());
+                break;
+            case SET_LINE_JOIN:
+                gc.setLineJoin(buf.getInt());
+                break;
+            case SET_MITER_LIMIT:
+                gc.setMiterLimit(buf.getFloat());
+                break;
+            case DRAWPOLYGON:
+                gc.drawPolygon(getPath(gm, bdata, buf), buf.getInt() == -1);
+                break;
+            case DRAWLINE:
+                gc.drawLine(
+                    buf.getInt(),
+                    buf.getInt(),
+                    buf.getInt(),
+                    buf.getInt());
+                break;
+            case DRAWIMAGE:
+                drawImage(gc,
+                    bdata.getRef(gm, buf.getInt()),
+                    //dest React
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    //src Rect
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat());
+                break;
+            case DRAWICON: {
+                int iconID = buf.getInt();
+                int x = buf.getInt();
+                int y = buf.getInt();
+                gc.drawIcon((WCIcon)bdata.getRef(gm, iconID), x, y);
+                break;
+            }
+            case DRAWPATTERN: {
+                int imageID = buf.getInt();
+                WCRectangle srcRect = getRectangle(buf);
+                int transformID = buf.getInt();
+                WCPoint phase = getPoint(buf);
+                WCRectangle destRect = getRectangle(buf);
+                drawPattern(gc,
+                    bdata.getRef(gm, imageID),
+                    srcRect,
+                    (WCTransform)bdata.getRef(gm, transformID),
+                    phase,
+                    destRect);
+                break;
+            }
+            case TRANSLATE:
+                gc.translate(buf.getFloat(), buf.getFloat());
+                break;
+            case SCALE:
+                gc.scale(buf.getFloat(), buf.getFloat());
+                break;
+            case SAVESTATE:
+                gc.saveState();
+                break;
+            case RESTORESTATE:
+                gc.restoreState();
+                break;
+            case CLIP_PATH:
+                gc.setClip(
+                    getPath(gm, bdata, buf),
+                    buf.getInt()>0);
+                break;
+            case SETCLIP_IIII:
+                gc.setClip(
+                    buf.getInt(),
+                    buf.getInt(),
+                    buf.getInt(),
+                    buf.getInt());
+                break;
+            case DRAWRECT:
+                gc.drawRect(
+                    buf.getInt(),
+                    buf.getInt(),
+                    buf.getInt(),
+                    buf.getInt());
+                break;
+            case SETCOMPOSITE:
+                gc.setComposite(buf.getInt());
+                break;
+            case STROKEARC:
+                gc.strokeArc(
+                    buf.getInt(),
+                    buf.getInt(),
+                    buf.getInt(),
+                    buf.getInt(),
+                    buf.getInt(),
+                    buf.getInt());
+                break;
+            case DRAWELLIPSE:
+                gc.drawEllipse(
+                    buf.getInt(),
+                    buf.getInt(),
+                    buf.getInt(),
+                    buf.getInt());
+                break;
+            case DRAWFOCUSRING:
+                gc.drawFocusRing(
+                    buf.getInt(),
+                    buf.getInt(),
+                    buf.getInt(),
+                    buf.getInt(),
+                    getColor(buf));
+                break;
+            case SETALPHA:
+                gc.setAlpha(buf.getFloat());
+                break;
+            case BEGINTRANSPARENCYLAYER:
+                gc.beginTransparencyLayer(buf.getFloat());
+                break;
+            case ENDTRANSPARENCYLAYER:
+                gc.endTransparencyLayer();
+                break;
+            case STROKE_PATH:
+                gc.strokePath(getPath(gm, bdata, buf));
+                break;
+            case FILL_PATH:
+                gc.fillPath(getPath(gm, bdata, buf));
+                break;
+            case SETSHADOW:
+                gc.setShadow(
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    buf.getFloat(),
+                    getColor(buf));
+                break;
+            case DRAWSTRING: {
+                int fontID = buf.getInt();
+                String str = bdata.getString(buf.getInt());
+                boolean rtl = (buf.getInt() == -1);
+                int from = buf.getInt();
+                int to = buf.getInt();
+                float x = buf.getFloat();
+                float y = buf.getFloat();
+                gc.drawString((WCFont) bdata.getRef(gm, fontID),
+                    str, rtl, from, to, x, y);
+                break;
+            }
+            case DRAWSTRING_FAST: {
+                int fontID = buf.getInt();
+                int[] glyphs = bdata.getIntArray(buf.getInt());
+                float[] offsets = bdata.getFloatArray(buf.getInt());
+                float x = buf.getFloat();
+                float y = buf.getFloat();
+                gc.drawString((WCFont) bdata.getRef(gm, fontID),
+                    glyphs, offsets, x, y);
+                break;
+            }
+            case DRAWSTRING_INLINE: {
+                int fontID = buf.getInt();
+                float x = buf.getFloat();
+                float y = buf.getFloat();
+                int n = buf.getInt();   // number of glyphs
+                int[] glyphs = new int[n];
+                buf.asIntBuffer().get(glyphs);
+                buf.position(buf.position() + n*4);
+                float[] advances = new float[n];
+                buf.asFloatBuffer().get(advances);
+                buf.position(buf.position() + n*4);
+                gc.drawString((WCFont) bdata.getRef(gm, fontID),
+                    glyphs, advances, x, y);
+                break;
+            }
+            case DRAWWIDGET: {
+                int themeID = buf.getInt();
+                int widgetID = buf.getInt();
+                int x = buf.getInt();
+                int y = buf.getInt();
+                gc.drawWidget((RenderTheme)(bdata.getRef(gm, themeID)),
+                    bdata.getRef(gm, widgetID), x, y);
+                break;
+            }
+            case DRAWSCROLLBAR: {
+                int themeID = buf.getInt();
+                int widgetID = buf.getInt();
+                int x = buf.getInt();
+                int y = buf.getInt();
+                int pressedPart = buf.getInt();
+                int hoveredPart = buf.getInt();
+                gc.drawScrollbar((ScrollBarTheme)(bdata.getRef(gm, themeID)),
+                    bdata.getRef(gm, widgetID), x, y, pressedPart, hoveredPart);
+                break;
+            }
+            case RENDERMEDIAPLAYER: {
+                int playerID = buf.getInt();
+                int x = buf.getInt();
+                int y = buf.getInt();
+                int width = buf.getInt();
+                int height = buf.getInt();
+                WCMediaPlayer mp = (WCMediaPlayer)bdata.getRef(gm, playerID);
+                mp.render(gc, x, y, width, height);
+                break;
+            }
+            case CONCATTRANSFORM_FFFFFF:
+                gc.concatTransform(new WCTransform(
+                        buf.getFloat(), buf.getFloat(), buf.getFloat(),
+                        buf.getFloat(), buf.getFloat(), buf.getFloat()));
+                break;
+            case SET_PERSPECTIVE_TRANSFORM:
+                gc.setPerspectiveTransform(new WCTransform(
                         buf.getFloat(), buf.getFloat(), buf.getFloat(), buf.getFloat(),
-                        // top corners w/h
                         buf.getFloat(), buf.getFloat(), buf.getFloat(), buf.getFloat(),
-                        // bottom corners w/h
                         buf.getFloat(), buf.getFloat(), buf.getFloat(), buf.getFloat(),
-                        getColor(buf));
-                    break;
-                case CLEARRECT_FFFF:
-                    gc.clearRect(
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        buf.getFloat());
-                    break;
-                case STROKERECT_FFFFF:
-                    gc.strokeRect(
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        buf.getFloat());
-                    break;
-                case SETFILLCOLOR:
-                    gc.setFillColor(getColor(buf));
-                    break;
-                case SET_TEXT_MODE:
-                    gc.setTextMode(getBoolean(buf), getBoolean(buf), getBoolean(buf));
-                    break;
-                case SETSTROKESTYLE:
-                    gc.setStrokeStyle(buf.getInt());
-                    break;
-                case SETSTROKECOLOR:
-                    gc.setStrokeColor(getColor(buf));
-                    break;
-                case SETSTROKEWIDTH:
-                    gc.setStrokeWidth(buf.getFloat());
-                    break;
-                case SET_FILL_GRADIENT:
-                    gc.setFillGradient(getGradient(gc, buf));
-                    break;
-                case SET_STROKE_GRADIENT:
-                    gc.setStrokeGradient(getGradient(gc, buf));
-                    break;
-                case SET_LINE_DASH:
-                    gc.setLineDash(buf.getFloat(), getFloatArray(buf));
-                    break;
-                case SET_LINE_CAP:
-                    gc.setLineCap(buf.getInt());
-                    break;
-                case SET_LINE_JOIN:
-                    gc.setLineJoin(buf.getInt());
-                    break;
-                case SET_MITER_LIMIT:
-                    gc.setMiterLimit(buf.getFloat());
-                    break;
-                case DRAWPOLYGON:
-                    gc.drawPolygon(getPath(gm, buf), buf.getInt() == -1);
-                    break;
-                case DRAWLINE:
-                    gc.drawLine(
-                        buf.getInt(),
-                        buf.getInt(),
-                        buf.getInt(),
-                        buf.getInt());
-                    break;
-                case DRAWIMAGE:
-                    drawImage(gc,
-                        gm.getRef(buf.getInt()),
-                        //dest React
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        //src Rect
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        buf.getFloat());
-                    break;
-                case DRAWICON:
-                    gc.drawIcon((WCIcon)gm.getRef(buf.getInt()),
-                        buf.getInt(),
-                        buf.getInt());
-                    break;
-                case DRAWPATTERN:
-                    drawPattern(gc,
-                        gm.getRef(buf.getInt()),
-                        getRectangle(buf),
-                        (WCTransform)gm.getRef(buf.getInt()),
-                        getPoint(buf),
-                        getRectangle(buf));
-                    break;
-                case TRANSLATE:
-                    gc.translate(buf.getFloat(), buf.getFloat());
-                    break;
-                case SCALE:
-                    gc.scale(buf.getFloat(), buf.getFloat());
-                    break;
-                case SAVESTATE:
-                    gc.saveState();
-                    break;
-                case RESTORESTATE:
-                    gc.restoreState();
-                    break;
-                case CLIP_PATH:
-                    gc.setClip(
-                        getPath(gm, buf),
-                        buf.getInt()>0);
-                    break;
-                case SETCLIP_IIII:
-                    gc.setClip(
-                        buf.getInt(),
-                        buf.getInt(),
-                        buf.getInt(),
-                        buf.getInt());
-                    break;
-                case DRAWRECT:
-                    gc.drawRect(
-                        buf.getInt(),
-                        buf.getInt(),
-                        buf.getInt(),
-                        buf.getInt());
-                    break;
-                case SETCOMPOSITE:
-                    gc.setComposite(buf.getInt());
-                    break;
-                case STROKEARC:
-                    gc.strokeArc(
-                        buf.getInt(),
-                        buf.getInt(),
-                        buf.getInt(),
-                        buf.getInt(),
-                        buf.getInt(),
-                        buf.getInt());
-                    break;
-                case DRAWELLIPSE:
-                    gc.drawEllipse(
-                        buf.getInt(),
-                        buf.getInt(),
-                        buf.getInt(),
-                        buf.getInt());
-                    break;
-                case DRAWFOCUSRING:
-                    gc.drawFocusRing(
-                        buf.getInt(),
-                        buf.getInt(),
-                        buf.getInt(),
-                        buf.getInt(),
-                        getColor(buf));
-                    break;
-                case SETALPHA:
-                    gc.setAlpha(buf.getFloat());
-                    break;
-                case BEGINTRANSPARENCYLAYER:
-                    gc.beginTransparencyLayer(buf.getFloat());
-                    break;
-                case ENDTRANSPARENCYLAYER:
-                    gc.endTransparencyLayer();
-                    break;
-                case STROKE_PATH:
-                    gc.strokePath(getPath(gm, buf));
-                    break;
-                case FILL_PATH:
-                    gc.fillPath(getPath(gm, buf));
-                    break;
-                case SETSHADOW:
-                    gc.setShadow(
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        buf.getFloat(),
-                        getColor(buf));
-                    break;
-                case DRAWSTRING:
-                    gc.drawString(
-                        (WCFont) gm.getRef(buf.getInt()),
-                        bdata.getString(buf.getInt()),
-                        (buf.getInt() == -1),           // rtl flag
-                        buf.getInt(), buf.getInt(),     // from and to positions
-                        buf.getFloat(), buf.getFloat());// (x,y) position
-                    break;
-                case DRAWSTRING_FAST:
-                    gc.drawString(
-                        (WCFont) gm.getRef(buf.getInt()),
-                        bdata.getIntArray(buf.getInt()), //glyphs
-                        bdata.getFloatArray(buf.getInt()), //offsets
-                        buf.getFloat(),
-                        buf.getFloat());
-                    break;
-                case DRAWWIDGET:
-                    gc.drawWidget((RenderTheme)(gm.getRef(buf.getInt())),
-                        gm.getRef(buf.getInt()), buf.getInt(), buf.getInt());
-                    break;
-                case DRAWSCROLLBAR:
-                    gc.drawScrollbar((ScrollBarTheme)(gm.getRef(buf.getInt())),
-                        gm.getRef(buf.getInt()), buf.getInt(), buf.getInt(),
-                        buf.getInt(), buf.getInt());
-                    break;
-                case RENDERMEDIAPLAYER:
-                    WCMediaPlayer mp = (WCMediaPlayer)gm.getRef(buf.getInt());
-                    mp.render(gc,
-                            buf.getInt(),   // x
-                            buf.getInt(),   // y
-                            buf.getInt(),   // width
-                            buf.getInt());  // height
-                    break;
-                case CONCATTRANSFORM_FFFFFF:
-                    gc.concatTransform(new WCTransform(
-                            buf.getFloat(), buf.getFloat(), buf.getFloat(),
-                            buf.getFloat(), buf.getFloat(), buf.getFloat()));
-                    break;
-                case SET_PERSPECTIVE_TRANSFORM:
-                    gc.setPerspectiveTransform(new WCTransform(
-                            buf.getFloat(), buf.getFloat(), buf.getFloat(), buf.getFloat(),
-                            buf.getFloat(), buf.getFloat(), buf.getFloat(), buf.getFloat(),
-                            buf.getFloat(), buf.getFloat(), buf.getFloat(), buf.getFloat(),
-                            buf.getFloat(), buf.getFloat(), buf.getFloat(), buf.getFloat()));
-                    break;
-                case SET_TRANSFORM:
-                    gc.setTransform(new WCTransform(
-                            buf.getFloat(), buf.getFloat(), buf.getFloat(),
-                            buf.getFloat(), buf.getFloat(), buf.getFloat()));
-                    break;
-                case COPYREGION:
-                    WCPageBackBuffer buffer = (WCPageBackBuffer)gm.getRef(buf.getInt());
-                    buffer.copyArea(buf.getInt(), buf.getInt(), buf.getInt(), buf.getInt(),
-                                    buf.getInt(), buf.getInt());
-                    break;
-                case DECODERQ:
-                    WCRenderQueue _rq = (WCRenderQueue)gm.getRef(buf.getInt());
-                    _rq.decode(gc.getFontSmoothingType());
-                    break;
-                case ROTATE:
-                    gc.rotate(buf.getFloat());
-                    break;
-                case RENDERMEDIACONTROL:
-                    RenderMediaControls.paintControl(gc,
-                            buf.getInt(),   // control type
-                            buf.getInt(),   // x
-                            buf.getInt(),   // y
-                            buf.getInt(),   // width
-                            buf.getInt());  // height
-                    break;
-                case RENDERMEDIA_TIMETRACK: {
-                    int n = buf.getInt();   // number of timeRange pairs
-                    float[] buffered = new float[n*2];
-                    buf.asFloatBuffer().get(buffered);
-                    buf.position(buf.position() + n*4 *2);
-                    RenderMediaControls.paintTimeSliderTrack(gc,
-                            buf.getFloat(), // duration
-                            buf.getFloat(), // currentTime
-                            buffered,       // buffered() timeRanges
-                            buf.getInt(),   // x
-                            buf.getInt(),   // y
-                            buf.getInt(),   // width
-                            buf.getInt());  // height
-                     break;
-                }
-                case RENDERMEDIA_VOLUMETRACK:
-                    RenderMediaControls.paintVolumeTrack(gc,
-                            buf.getFloat(), // curVolume
-                            buf.getInt() != 0,  // muted
-                            buf.getInt(),   // x
-                            buf.getInt(),   // y
-                            buf.getInt(),   // width
-                            buf.getInt());  // height
-                    break;
-                default:
-                    log.fine("ERROR. Unknown primitive found");
-                    break;
+                        buf.getFloat(), buf.getFloat(), buf.getFloat(), buf.getFloat()));
+                break;
+            case SET_TRANSFORM:
+                gc.setTransform(new WCTransform(
+                        buf.getFloat(), buf.getFloat(), buf.getFloat(),
+                        buf.getFloat(), buf.getFloat(), buf.getFloat()));
+                break;
+            case COPYREGION: {
+                int bufferID = buf.getInt();
+                int x = buf.getInt();
+                int y = buf.getInt();
+                int width = buf.getInt();
+                int height = buf.getInt();
+                int dx = buf.getInt();
+                int dy = buf.getInt();
+                WCPageBackBuffer buffer = (WCPageBackBuffer)bdata.getRef(gm, bufferID);
+                buffer.copyArea(x, y, width, height, dx, dy);
+                break;
             }
+            case DECODERQ:
+                WCRenderQueue _rq = (WCRenderQueue)bdata.getRef(gm, buf.getInt());
+                _rq.decode(gc.getFontSmoothingType());
+                break;
+            case ROTATE:
+                gc.rotate(buf.getFloat());
+                break;
+            case RENDERMEDIACONTROL:
+                RenderMediaControls.paintControl(gc,
+                        buf.getInt(),   // control type
+                        buf.getInt(),   // x
+                        buf.getInt(),   // y
+                        buf.getInt(),   // width
+                        buf.getInt());  // height
+                break;
+            case RENDERMEDIA_TIMETRACK: {
+                int n = buf.getInt();   // number of timeRange pairs
+                float[] buffered = new float[n*2];
+                buf.asFloatBuffer().get(buffered);
+                buf.position(buf.position() + n*4 *2);
+                RenderMediaControls.paintTimeSliderTrack(gc,
+                        buf.getFloat(), // duration
+                        buf.getFloat(), // currentTime
+                        buffered,       // buffered() timeRanges
+                        buf.getInt(),   // x
+                        buf.getInt(),   // y
+                        buf.getInt(),   // width
+                        buf.getInt());  // height
+                 break;
+            }
+            case RENDERMEDIA_VOLUMETRACK:
+                RenderMediaControls.paintVolumeTrack(gc,
+                        buf.getFloat(), // curVolume
+                        buf.getInt() != 0,  // muted
+                        buf.getInt(),   // x
+                        buf.getInt(),   // y
+                        buf.getInt(),   // width
+                        buf.getInt());  // height
+                break;
+            default:
+                log.fine("ERROR. Unknown primitive found");
+                break;
         }
     }
 
-
     private static void drawPattern(
             WCGraphicsContext gc,
             Object imgFrame,
@@ -460,9 +530,11 @@ public final class GraphicsDecoder  {
         return array;
     }
 
-    private static WCPath getPath(WCGraphicsManager gm, ByteBuffer buf) {
-        WCPath path = (WCPath) gm.getRef(buf.getInt());
-        path.setWindingRule(buf.getInt());
+    private static WCPath getPath(WCGraphicsManager gm, BufferData bdata, ByteBuffer buf) {
+        int pathID = buf.getInt();
+        int windingRule = buf.getInt();
+        WCPath path = (WCPath) bdata.getRef(gm, pathID);
+        path.setWindingRule(windingRule);
         return path;
     }
 
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.graphics;
+
+import com.sun.javafx.font.FontResource;
+import com.sun.javafx.font.PGFont;
+import com.sun.javafx.logging.PlatformLogger;
+import java.io.BufferedOutputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.DataOutputStream;
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.Map;
+import java.util.Set;
+import java.util.zip.CRC32;
+
+/**
+ * Writes every buffer flushed by the native render queues to a file, together
+ * with the objects the buffers refer to, so that the drawing can be replayed
+ * later by {@link RenderQueueReplay} without loading the page again.
+ * <p>
+ * Paths, transforms, fonts and images are recorded by value. Paths are
+ * recorded again whenever they are used and images whenever their pixels
+ * changed, so canvases and image buffers replay as they were drawn. Other
+ * referenced objects (nested render queues, themes, media players, page back
+ * buffers) are recorded as unsupported and are missing on replay.
+ * <p>
+ * All methods must be called on the Event thread.
+ */
+public final class RenderQueueRecorder {
+
+    private final static PlatformLogger log =
+            PlatformLogger.getLogger(RenderQueueRecorder.class.getName());
+
+    static final int MAGIC = 0x57435251; // "WCRQ"
+    static final int VERSION = 1;
+
+    static final int RECORD_REF = 1;
+    static final int RECORD_BUFFER = 2;
+
+    static final int REF_UNSUPPORTED = 0;
+    static final int REF_PATH = 1;
+    static final int REF_TRANSFORM = 2;
+    static final int REF_FONT = 3;
+    static final int REF_IMAGE = 4;
+
+    private static RenderQueueRecorder recorder;
+
+    private final DataOutputStream out;
+    /* Paths and images are mutable, so only the immutable kinds are written once */
+    private final Set<Integer> writtenRefs = new HashSet<>();
+    /* The checksum of the pixels last written for each image */
+    private final Map<Integer,Long> imageChecksums = new HashMap<>();
+    private int bufferCount;
+
+    private RenderQueueRecorder(File file) throws IOException {
+        out = new DataOutputStream(
+                new BufferedOutputStream(new FileOutputStream(file)));
+        out.writeInt(MAGIC);
+        out.writeInt(VERSION);
+        out.writeBoolean(ByteOrder.nativeOrder() == ByteOrder.LITTLE_ENDIAN);
+    }
+
+    /**
+     * Starts recording the render queues of all pages to the given file.
+     */
+    public static void start(File file) throws IOException {
+        if (recorder != null) {
+            throw new IllegalStateException("Already recording");
+        }
+        recorder = new RenderQueueRecorder(file);
+        WCRenderQueue.twkSetRecording(true);
+    }
+
+    /**
+     * Stops recording and closes the file.
+     *
+     * @return the number of buffers recorded
+     */
+    public static int stop() throws IOException {
+        if (recorder == null) {
+            return 0;
+        }
+        WCRenderQueue.twkSetRecording(false);
+        RenderQueueRecorder r = recorder;
+        recorder = null;
+        r.out.close();
+        return r.bufferCount;
+    }
+
+    /*
+     * Called from WCRenderQueue.fwkAddRecordedBuffer before the buffer is
+     * queued. Any failure ends the recording rather than the painting.
+     */
+    static void record(WCRenderQueue rq, BufferData bdata, ByteBuffer buffer,
+                       int[] refIDs, Object[] refs) {
+        RenderQueueRecorder r = recorder;
+        if (r == null) {
+            return;
+        }
+        try {
+            r.write(rq, bdata, buffer, refIDs, refs);
+        } catch (IOException e) {
+            log.warning("Render queue recording stopped", e);
+            try {
+                stop();
+            } catch (IOException ignore) {
+            }
+        }
+    }
+
+    private void write(WCRenderQueue rq, BufferData bdata, ByteBuffer buffer,
+                       int[] refIDs, Object[] refs) throws IOException {
+        int refCount = 0;
+        for (int i = 0; i < refs.length; i++) {
+            if (refs[i] instanceof Ref) {
+                writeRef(refIDs[i], (Ref) refs[i]);
+                refCount++;
+            }
+        }
+
+        out.writeByte(RECORD_BUFFER);
+        out.writeInt(rq.getID());
+        ByteBuffer bytes = buffer.duplicate();
+        byte[] data = new byte[bytes.remaining()];
+        bytes.get(data);
+        out.writeInt(data.length);
+        out.write(data);
+
+        Map<Integer,String> strings = bdata.getStrings();
+        out.writeInt(strings.size());
+        for (Map.Entry<Integer,String> e : strings.entrySet()) {
+            out.writeInt(e.getKey());
+            writeString(out, e.getValue());
+        }
+        Map<Integer,int[]> intArrays = bdata.getIntArrays();
+        out.writeInt(intArrays.size());
+        for (Map.Entry<Integer,int[]> e : intArrays.entrySet()) {
+            out.writeInt(e.getKey());
+            out.writeInt(e.getValue().length);
+            for (int v : e.getValue()) {
+                out.writeInt(v);
+            }
+        }
+        Map<Integer,float[]> floatArrays = bdata.getFloatArrays();
+        out.writeInt(floatArrays.size());
+        for (Map.Entry<Integer,float[]> e : floatArrays.entrySet()) {
+            out.writeInt(e.getKey());
+            out.writeInt(e.getValue().length);
+            for (float v : e.getValue()) {
+                out.writeFloat(v);
+            }
+        }
+
+        out.writeInt(refCount);
+        for (int i = 0; i < refs.length; i++) {
+            if (refs[i] instanceof Ref) {
+                out.writeInt(refIDs[i]);
+            }
+        }
+        bufferCount++;
+    }
+
+    /*
+     * id is the one the buffers use for the object, assigned on the native
+     * side rather than Ref.getID.
+     */
+    private void writeRef(int id, Ref ref) throws IOException {
+        boolean image = ref instanceof WCImage || ref instanceof WCImageFrame;
+        if (!(ref instanceof WCPath) && !image && !writtenRefs.add(id)) {
+            return;
+        }
+
+        // The payload is built apart so that an object failing half way
+        // through is still written as a whole, if unsupported, record.
+        ByteArrayOutputStream bytes = new ByteArrayOutputStream();
+        DataOutputStream payload = new DataOutputStream(bytes);
+        int kind;
+        try {
+            kind = writePayload(ref, payload);
+        } catch (RuntimeException e) {
+            log.fine("Cannot record " + ref, e);
+            kind = REF_UNSUPPORTED;
+        }
+        if (kind == REF_UNSUPPORTED) {
+            bytes.reset();
+        }
+        if (image) {
+            CRC32 checksum = new CRC32();
+            checksum.update(bytes.toByteArray());
+            Long previous = imageChecksums.put(id, checksum.getValue());
+            if (previous != null && previous == checksum.getValue()) {
+                return;
+            }
+        }
+
+        out.writeByte(RECORD_REF);
+        out.writeInt(id);
+        out.writeByte(kind);
+        out.writeInt(bytes.size());
+        bytes.writeTo(out);
+    }
+
+    private static int writePayload(Ref ref, DataOutputStream out) throws IOException {
+        if (ref instanceof WCPath) {
+            WCPath<?> path = (WCPath<?>) ref;
+            out.writeInt(path.getWindingRule());
+            double[] coords = new double[6];
+            for (WCPathIterator it = path.getPathIterator(); !it.isDone(); it.next()) {
+                int type = it.currentSegment(coords);
+                out.writeByte(type);
+                for (int i = 0; i < segmentCoordCount(type); i++) {
+                    out.writeDouble(coords[i]);
+                }
+            }
+            out.writeByte(-1);
+            return REF_PATH;
+        }
+        if (ref instanceof WCTransform) {
+            double[] m = ((WCTransform) ref).getMatrix();
+            out.writeInt(m.length);
+            for (double v : m) {
+                out.writeDouble(v);
+            }
+            return REF_TRANSFORM;
+        }
+        if (ref instanceof WCFont) {
+            Object platformFont = ((WCFont) ref).getPlatformFont();
+            if (!(platformFont instanceof PGFont)) {
+                return REF_UNSUPPORTED;
+            }
+            PGFont font = (PGFont) platformFont;
+            FontResource resource = font.getFontResource();
+            writeString(out, font.getFamilyName());
+            out.writeBoolean(resource.isBold());
+            out.writeBoolean(resource.isItalic());
+            out.writeFloat(font.getSize());
+            return REF_FONT;
+        }
+        if (ref instanceof WCImage || ref instanceof WCImageFrame) {
+            WCImage image = WCImage.getImage(ref);
+            ByteBuffer pixels = image.getPixelBuffer();
+            if (pixels == null) {
+                return REF_UNSUPPORTED;
+            }
+            pixels = pixels.duplicate();
+            pixels.rewind();
+            byte[] data = new byte[pixels.remaining()];
+            pixels.get(data);
+            out.writeInt(image.getWidth());
+            out.writeInt(image.getHeight());
+            out.writeInt(data.length);
+            out.write(data);
+            return REF_IMAGE;
+        }
+        return REF_UNSUPPORTED;
+    }
+
+    static int segmentCoordCount(int type) {
+        switch (type) {
+            case WCPathIterator.SEG_MOVETO:
+            case WCPathIterator.SEG_LINETO:
+                return 2;
+            case WCPathIterator.SEG_QUADTO:
+                return 4;
+            case WCPathIterator.SEG_CUBICTO:
+                return 6;
+            default:
+                return 0;
+        }
+    }
+
+    /* Strings in the queue may exceed the 64K limit of writeUTF */
+    private static void writeString(DataOutputStream out, String s) throws IOException {
+        out.writeInt(s.length());
+        out.writeChars(s);
+    }
+}
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.graphics;
+
+import java.io.BufferedInputStream;
+import java.io.DataInputStream;
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.lang.reflect.Field;
+import java.lang.reflect.Modifier;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+import static com.sun.webkit.graphics.RenderQueueRecorder.*;
+
+/**
+ * Replays a file written by {@link RenderQueueRecorder} into an offscreen
+ * image, timing every primitive, so that changes to the graphics context
+ * can be measured on a fixed drawing workload.
+ * <p>
+ * All buffers are decoded in recording order into the same image, whatever
+ * queue they came from. Primitives whose referenced objects could not be
+ * recorded are counted as failures.
+ */
+public final class RenderQueueReplay {
+
+    /** Index of the number of calls in a profile entry. */
+    public static final int COUNT = 0;
+    /** Index of the total decoding time, in nanoseconds, in a profile entry. */
+    public static final int TIME = 1;
+    /** Index of the number of failed calls in a profile entry. */
+    public static final int FAILURES = 2;
+
+    private static String[] opcodeNames;
+
+    private static final class RecordedBuffer {
+        private final byte[] data;
+        private final Map<Integer,String> strings = new HashMap<>();
+        private final Map<Integer,int[]> intArrays = new HashMap<>();
+        private final Map<Integer,float[]> floatArrays = new HashMap<>();
+        private final Map<Integer,Ref> refs = new HashMap<>();
+
+        private RecordedBuffer(byte[] data) {
+            this.data = data;
+        }
+    }
+
+    private final List<RecordedBuffer> buffers = new ArrayList<>();
+    private int unsupportedRefCount;
+
+    private RenderQueueReplay() {
+    }
+
+    /**
+     * Reads a recording, recreating the referenced objects through the
+     * current graphics manager.
+     */
+    public static RenderQueueReplay load(File file) throws IOException {
+        WCGraphicsManager gm = WCGraphicsManager.getGraphicsManager();
+        RenderQueueReplay replay = new RenderQueueReplay();
+        Map<Integer,Ref> refs = new HashMap<>();
+        try (DataInputStream in = new DataInputStream(
+                new BufferedInputStream(new FileInputStream(file)))) {
+            if (in.readInt() != MAGIC || in.readInt() != VERSION) {
+                throw new IOException("Not a render queue recording: " + file);
+            }
+            boolean littleEndian = in.readBoolean();
+            if (littleEndian != (ByteOrder.nativeOrder() == ByteOrder.LITTLE_ENDIAN)) {
+                throw new IOException("Recorded with a different byte order: " + file);
+            }
+            int type;
+            while ((type = in.read()) != -1) {
+                switch (type) {
+                    case RECORD_REF:
+                        int id = in.readInt();
+                        Ref ref = readRef(gm, in);
+                        if (ref == null) {
+                            replay.unsupportedRefCount++;
+                        }
+                        refs.put(id, ref);
+                        break;
+                    case RECORD_BUFFER:
+                        replay.buffers.add(readBuffer(in, refs));
+                        break;
+                    default:
+                        throw new IOException("Unknown record " + type + " in " + file);
+                }
+            }
+        }
+        return replay;
+    }
+
+    private static Ref readRef(WCGraphicsManager gm, DataInputStream in) throws IOException {
+        int kind = in.readByte();
+        int size = in.readInt();
+        switch (kind) {
+            case REF_PATH: {
+                WCPath<?> path = gm.createWCPath();
+                path.setWindingRule(in.readInt());
+                double[] c = new double[6];
+                int segment;
+                while ((segment = in.readByte()) != -1) {
+                    for (int i = 0; i < segmentCoordCount(segment); i++) {
+                        c[i] = in.readDouble();
+                    }
+                    switch (segment) {
+                        case WCPathIterator.SEG_MOVETO:
+                            path.moveTo(c[0], c[1]);
+                            break;
+                        case WCPathIterator.SEG_LINETO:
+                            path.addLineTo(c[0], c[1]);
+                            break;
+                        case WCPathIterator.SEG_QUADTO:
+                            path.addQuadCurveTo(c[0], c[1], c[2], c[3]);
+                            break;
+                        case WCPathIterator.SEG_CUBICTO:
+                            path.addBezierCurveTo(c[0], c[1], c[2], c[3], c[4], c[5]);
+                            break;
+                        case WCPathIterator.SEG_CLOSE:
+                            path.closeSubpath();
+                            break;
+                    }
+                }
+                return path;
+            }
+            case REF_TRANSFORM: {
+                double[] m = new double[in.readInt()];
+                for (int i = 0; i < m.length; i++) {
+                    m[i] = in.readDouble();
+                }
+                // getMatrix() returns the 3D matrix in column-major order
+                return m.length == 6
+                        ? new WCTransform(m[0], m[1], m[2], m[3], m[4], m[5])
+                        : new WCTransform(m[0], m[4], m[8], m[12],
+                                          m[1], m[5], m[9], m[13],
+                                          m[2], m[6], m[10], m[14],
+                                          m[3], m[7], m[11], m[15]);
+            }
+            case REF_FONT: {
+                String family = readString(in);
+                boolean bold = in.readBoolean();
+                boolean italic = in.readBoolean();
+                return gm.getWCFont(family, bold, italic, in.readFloat());
+            }
+            case REF_IMAGE: {
+                int w = in.readInt();
+                int h = in.readInt();
+                byte[] data = new byte[in.readInt()];
+                in.readFully(data);
+                return gm.createFrame(w, h, ByteBuffer.wrap(data));
+            }
+            default:
+                in.skipNBytes(size);
+                return null;
+        }
+    }
+
+    private static RecordedBuffer readBuffer(DataInputStream in, Map<Integer,Ref> refs)
+            throws IOException {
+        in.readInt(); // the id of the recorded queue
+        byte[] data = new byte[in.readInt()];
+        in.readFully(data);
+        RecordedBuffer b = new RecordedBuffer(data);
+        for (int n = in.readInt(); n > 0; n--) {
+            int id = in.readInt();
+            b.strings.put(id, readString(in));
+        }
+        for (int n = in.readInt(); n > 0; n--) {
+            int id = in.readInt();
+            int[] a = new int[in.readInt()];
+            for (int i = 0; i < a.length; i++) {
+                a[i] = in.readInt();
+            }
+            b.intArrays.put(id, a);
+        }
+        for (int n = in.readInt(); n > 0; n--) {
+            int id = in.readInt();
+            float[] a = new float[in.readInt()];
+            for (int i = 0; i < a.length; i++) {
+                a[i] = in.readFloat();
+            }
+            b.floatArrays.put(id, a);
+        }
+        // Paths are recorded again whenever they are used, so each buffer
+        // keeps the objects as they were when it was flushed.
+        for (int n = in.readInt(); n > 0; n--) {
+            int id = in.readInt();
+            b.refs.put(id, refs.get(id));
+        }
+        return b;
+    }
+
+    private static String readString(DataInputStream in) throws IOException {
+        char[] chars = new char[in.readInt()];
+        for (int i = 0; i < chars.length; i++) {
+            chars[i] = in.readChar();
+        }
+        return new String(chars);
+    }
+
+    public int getBufferCount() {
+        return buffers.size();
+    }
+
+    /**
+     * Returns the number of referenced objects that could not be recorded.
+     */
+    public int getUnsupportedRefCount() {
+        return unsupportedRefCount;
+    }
+
+    /**
+     * Decodes all recorded buffers into a new offscreen image of the given
+     * size, the given number of times.
+     *
+     * @return the accumulated {@link #COUNT}, {@link #TIME} and
+     *         {@link #FAILURES} of each opcode, indexed by opcode
+     */
+    public long[][] run(int width, int height, int iterations) {
+        WCGraphicsManager gm = WCGraphicsManager.getGraphicsManager();
+        long[][] profile = new long[getOpcodeNames().length][3];
+        WCImage image = gm.createRTImage(width, height);
+        WCRenderQueue rq = gm.createBufferedContextRQ(image);
+        for (int i = 0; i < iterations; i++) {
+            for (RecordedBuffer b : buffers) {
+                BufferData bdata = new BufferData();
+                bdata.getStrings().putAll(b.strings);
+                bdata.getIntArrays().putAll(b.intArrays);
+                bdata.getFloatArrays().putAll(b.floatArrays);
+                bdata.setBuffer(ByteBuffer.wrap(b.data), 0L);
+                bdata.setReplay(b.refs, profile);
+                rq.addBuffer(bdata);
+            }
+            // Decodes the queue synchronously on the render thread
+            image.getPixelBuffer();
+        }
+        return profile;
+    }
+
+    /**
+     * Returns the names of the GraphicsDecoder opcodes, indexed by opcode;
+     * unused opcodes have a null name.
+     */
+    public static synchronized String[] getOpcodeNames() {
+        if (opcodeNames == null) {
+            Map<Integer,String> names = new HashMap<>();
+            int max = 0;
+            for (Field f : GraphicsDecoder.class.getDeclaredFields()) {
+                int mod = f.getModifiers();
+                if (f.getType() == int.class && Modifier.isStatic(mod)
+                        && Modifier.isPublic(mod)) {
+                    try {
+                        int op = f.getInt(null);
+                        names.put(op, f.getName());
+                        max = Math.max(max, op);
+                    } catch (IllegalAccessException e) {
+                        throw new AssertionError(e);
+                    }
+                }
+            }
+            opcodeNames = new String[max + 1];
+            names.forEach((op, name) -> opcodeNames[op] = name);
+        }
+        return opcodeNames.clone();
+    }
+}
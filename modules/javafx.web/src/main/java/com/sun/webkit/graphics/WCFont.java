@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2018, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,6 +41,28 @@ public abstract class WCFont extends Ref {
 
     public abstract float[] getGlyphBoundingBox(int glyph);
 
+    /**
+     * Fills {@code widths} with the advances of the glyphs starting
+     * at {@code firstGlyph}.
+     * NB: This method is called from native code!
+     */
+    public void getGlyphWidths(int firstGlyph, float[] widths) {
+        for (int i = 0; i < widths.length; i++) {
+            widths[i] = (float) getGlyphWidth(firstGlyph + i);
+        }
+    }
+
+    /**
+     * Fills {@code boxes} with the bounding boxes (x, y, width, height)
+     * of the glyphs starting at {@code firstGlyph}.
+     * NB: This method is called from native code!
+     */
+    public void getGlyphBoundingBoxes(int firstGlyph, float[] boxes) {
+        for (int i = 0; i < boxes.length / 4; i++) {
+            System.arraycopy(getGlyphBoundingBox(firstGlyph + i), 0, boxes, 4 * i, 4);
+        }
+    }
+
     /**
      * Returns a hash code value for the object.
      * NB: This method is called from native code!
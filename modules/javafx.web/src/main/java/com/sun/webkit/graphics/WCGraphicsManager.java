@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -163,5 +163,51 @@ public abstract class WCGraphicsManager {
         return refMap.get(id);
     }
 
+    /*
+     * Applies the references assigned and released by the native RQRef table,
+     * given as {int[] assigned ids, Object[] their objects, int[] released ids}
+     * or null. The native ids are negative so they never clash with the ones
+     * from createID. Each native id holds one reference to its object, and the
+     * assignments go first so that an object still in use is not disposed.
+     * Applying the same updates again, as the native side does when the call
+     * that carried them failed, changes nothing.
+     * Called on the Event thread.
+     */
+    void updateRefs(Object[] updates) {
+        if (updates == null) {
+            return;
+        }
+        int[] assignedIDs = (int[]) updates[0];
+        Object[] assigned = (Object[]) updates[1];
+        int[] releasedIDs = (int[]) updates[2];
+
+        Ref[] added = new Ref[assignedIDs.length];
+        synchronized (this) {
+            for (int i = 0; i < assignedIDs.length; i++) {
+                Ref ref = (Ref) assigned[i];
+                if (refMap.put(assignedIDs[i], ref) != ref) {
+                    added[i] = ref;
+                }
+            }
+        }
+        for (Ref ref : added) {
+            if (ref != null) {
+                ref.ref();
+            }
+        }
+
+        Ref[] released = new Ref[releasedIDs.length];
+        synchronized (this) {
+            for (int i = 0; i < releasedIDs.length; i++) {
+                released[i] = refMap.remove(releasedIDs[i]);
+            }
+        }
+        for (Ref ref : released) {
+            if (ref != null) {
+                ref.deref();
+            }
+        }
+    }
+
     private static native void append(long bufPtr, byte[] data, int count);
 }
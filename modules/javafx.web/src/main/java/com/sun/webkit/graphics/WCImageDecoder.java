@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -49,10 +49,13 @@ public abstract class WCImageDecoder {
     protected abstract int getFrameCount();
 
     /**
-     * Returns image frame at the specified index.
+     * Returns image frame at the specified index. This method may be
+     * called on an image decoding thread rather than the event thread.
      * @param index frame index
+     * @param width requested frame width, or {@code 0} for the original size
+     * @param height requested frame height, or {@code 0} for the original size
      */
-    protected abstract WCImageFrame getFrame(int index);
+    protected abstract WCImageFrame getFrame(int index, int width, int height);
 
     /**
      * Returns frame duration in ms
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -53,6 +53,19 @@ public abstract class WCPath<P> extends Ref {
      */
     @Native public static final int RULE_EVENODD = 1;
 
+    /* Segment opcodes of the packed form produced by the native PathJava,
+     * see addSegments().
+     */
+    @Native public static final int SEGMENT_MOVETO  = 0;
+    @Native public static final int SEGMENT_LINETO  = 1;
+    @Native public static final int SEGMENT_QUADTO  = 2;
+    @Native public static final int SEGMENT_CUBICTO = 3;
+    @Native public static final int SEGMENT_ARCTO   = 4;
+    @Native public static final int SEGMENT_ARC     = 5;
+    @Native public static final int SEGMENT_ELLIPSE = 6;
+    @Native public static final int SEGMENT_RECT    = 7;
+    @Native public static final int SEGMENT_CLOSE   = 8;
+
     public abstract void addRect(double x, double y, double w, double h);
 
     public abstract void addEllipse(double x, double y, double w, double h);
@@ -98,6 +111,61 @@ public abstract class WCPath<P> extends Ref {
 
     public abstract WCPathIterator getPathIterator();
 
+    /**
+     * Appends segments recorded on the native side in one call.
+     * NB: This method is called from native code!
+     *
+     * @param ops     segment opcodes, one of the SEGMENT_* constants
+     * @param coords  the arguments of all segments, in order; the direction
+     *                flag of SEGMENT_ARC is stored as 0 or 1
+     */
+    public void addSegments(int[] ops, float[] coords) {
+        int c = 0;
+        for (int op : ops) {
+            switch (op) {
+                case SEGMENT_MOVETO:
+                    moveTo(coords[c], coords[c + 1]);
+                    c += 2;
+                    break;
+                case SEGMENT_LINETO:
+                    addLineTo(coords[c], coords[c + 1]);
+                    c += 2;
+                    break;
+                case SEGMENT_QUADTO:
+                    addQuadCurveTo(coords[c], coords[c + 1], coords[c + 2], coords[c + 3]);
+                    c += 4;
+                    break;
+                case SEGMENT_CUBICTO:
+                    addBezierCurveTo(coords[c], coords[c + 1], coords[c + 2],
+                                     coords[c + 3], coords[c + 4], coords[c + 5]);
+                    c += 6;
+                    break;
+                case SEGMENT_ARCTO:
+                    addArcTo(coords[c], coords[c + 1], coords[c + 2], coords[c + 3], coords[c + 4]);
+                    c += 5;
+                    break;
+                case SEGMENT_ARC:
+                    addArc(coords[c], coords[c + 1], coords[c + 2], coords[c + 3],
+                           coords[c + 4], coords[c + 5] != 0);
+                    c += 6;
+                    break;
+                case SEGMENT_ELLIPSE:
+                    addEllipse(coords[c], coords[c + 1], coords[c + 2], coords[c + 3]);
+                    c += 4;
+                    break;
+                case SEGMENT_RECT:
+                    addRect(coords[c], coords[c + 1], coords[c + 2], coords[c + 3]);
+                    c += 4;
+                    break;
+                case SEGMENT_CLOSE:
+                    closeSubpath();
+                    break;
+                default:
+                    throw new IllegalArgumentException("Unknown path segment: " + op);
+            }
+        }
+    }
+
     public abstract boolean strokeContains(double x, double y,
                                            double thickness, double miterLimit,
                                            int cap, int join, double dashOffset,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,10 +29,13 @@ import java.lang.annotation.Native;
 import com.sun.javafx.logging.PlatformLogger;
 import com.sun.javafx.logging.PlatformLogger.Level;
 import com.sun.webkit.Invoker;
+import com.sun.webkit.perf.PerfCounters;
 import java.nio.ByteBuffer;
 import java.util.HashMap;
 import java.util.LinkedList;
+import java.util.Map;
 import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
 
 public abstract class WCRenderQueue extends Ref {
     private final static AtomicInteger idCountObj = new AtomicInteger(0);
@@ -40,6 +43,16 @@ public abstract class WCRenderQueue extends Ref {
             PlatformLogger.getLogger(WCRenderQueue.class.getName());
     @Native public final static int MAX_QUEUE_SIZE = 0x80000;
 
+    // See addDecodeCounters. Only collected while the perf counters are
+    // enabled. A queue decoded from within another one (DECODERQ) adds its
+    // time to the outer queue only.
+    private final static AtomicLong decodeCount = new AtomicLong();
+    private final static AtomicLong decodedBufferCount = new AtomicLong();
+    private final static AtomicLong decodedByteCount = new AtomicLong();
+    private final static AtomicLong decodeNanos = new AtomicLong();
+    private final static ThreadLocal<int[]> decodeDepth =
+            ThreadLocal.withInitial(() -> new int[1]);
+
     private final LinkedList<BufferData> buffers = new LinkedList<>();
     private BufferData currentBuffer = new BufferData();
     private final WCRectangle clip;
@@ -66,19 +79,38 @@ public abstract class WCRenderQueue extends Ref {
     }
 
     public synchronized void addBuffer(ByteBuffer buffer) {
+        addBuffer(buffer, 0L);
+    }
+
+    /*
+     * nativeBuffer is the handle of the native ByteBuffer backing the given
+     * buffer, or 0 for a buffer allocated on the java side.
+     */
+    private synchronized void addBuffer(ByteBuffer buffer, long nativeBuffer) {
         if (log.isLoggable(Level.FINE) && buffers.isEmpty()) {
             log.fine("'{'WCRenderQueue{0}[{1}]",
                     new Object[]{hashCode(), idCountObj.incrementAndGet()});
         }
-        currentBuffer.setBuffer(buffer);
+        // Nothing may throw once the buffer is in the list, see fwkAddBuffer.
+        BufferData next = new BufferData();
+        currentBuffer.setBuffer(buffer, nativeBuffer);
         buffers.addLast(currentBuffer);
-        currentBuffer = new BufferData();
-        size += buffer.capacity();
+        currentBuffer = next;
+        size += buffer.limit();
         if (size > MAX_QUEUE_SIZE && gc!=null) {
             // It is isolated queue over the canvas image [image-gc!=null].
             // We need to flush the changes periodically
             // by the same reason as in [WebPage.addLastRQ].
-            flush();
+            try {
+                flush();
+            } catch (RuntimeException e) {
+                if (nativeBuffer == 0L) {
+                    throw e;
+                }
+                // The native side frees the buffer if fwkAddBuffer throws,
+                // but this one is already queued.
+                log.warning("Render queue flush failed", e);
+            }
         }
     }
 
@@ -92,7 +124,33 @@ public abstract class WCRenderQueue extends Ref {
             return;
         }
 
+        if (PerfCounters.isEnabled()) {
+            decodeTimed(gc);
+        } else {
+            decodeBuffers(gc, false);
+        }
+        dispose();
+    }
+
+    private void decodeTimed(WCGraphicsContext gc) {
+        int[] depth = decodeDepth.get();
+        long start = depth[0]++ == 0 ? System.nanoTime() : 0L;
+        try {
+            decodeBuffers(gc, true);
+        } finally {
+            if (--depth[0] == 0) {
+                decodeCount.incrementAndGet();
+                decodeNanos.addAndGet(System.nanoTime() - start);
+            }
+        }
+    }
+
+    private void decodeBuffers(WCGraphicsContext gc, boolean counted) {
         for (BufferData bdata : buffers) {
+            if (counted) {
+                decodedBufferCount.incrementAndGet();
+                decodedByteCount.addAndGet(bdata.getBuffer().limit());
+            }
             try {
                 GraphicsDecoder.decode(
                     WCGraphicsManager.getGraphicsManager(), gc, bdata);
@@ -100,7 +158,6 @@ public abstract class WCRenderQueue extends Ref {
                 e.printStackTrace(System.err);
             }
         }
-        dispose();
     }
 
     public synchronized void decode() {
@@ -127,8 +184,38 @@ public abstract class WCRenderQueue extends Ref {
         flush();
     }
 
-    private void fwkAddBuffer(ByteBuffer buffer) {
-        addBuffer(buffer);
+    /*
+     * refUpdates carries the references assigned and released on the native
+     * side since the last call, see WCGraphicsManager.updateRefs. If this
+     * throws, the buffer has not been added: the native side then frees it
+     * and sends the same updates again with the next buffer.
+     */
+    private void fwkAddBuffer(ByteBuffer buffer, int size, long nativeBuffer,
+                              Object[] refUpdates) {
+        // The native side reuses the same direct buffer for recycled memory,
+        // so only the first size bytes are meaningful.
+        buffer.clear().limit(size);
+        WCGraphicsManager.getGraphicsManager().updateRefs(refUpdates);
+        addBuffer(buffer, nativeBuffer);
+    }
+
+    private void fwkAddRecordedBuffer(ByteBuffer buffer, int size, long nativeBuffer,
+                                      Object[] refUpdates, int[] refIDs, Object[] refs) {
+        buffer.clear().limit(size);
+        // Recording goes first so that, as in fwkAddBuffer, nothing that
+        // throws comes after the updates are applied.
+        RenderQueueRecorder.record(this, currentBuffer, buffer, refIDs, refs);
+        WCGraphicsManager.getGraphicsManager().updateRefs(refUpdates);
+        addBuffer(buffer, nativeBuffer);
+    }
+
+    /*
+     * Adds a buffer that has no native counterpart, such as one read back
+     * by RenderQueueReplay.
+     */
+    synchronized void addBuffer(BufferData bdata) {
+        buffers.addLast(bdata);
+        size += bdata.getBuffer().limit();
     }
 
     public WCRectangle getClip() {
@@ -139,13 +226,13 @@ public abstract class WCRenderQueue extends Ref {
         int n = buffers.size();
         if (n > 0) {
             int i = 0;
-            final Object[] arr = new Object[n];
+            final long[] arr = new long[n];
             for (BufferData bdata: buffers) {
-                arr[i++] = bdata.getBuffer();
+                arr[i++] = bdata.getNativeBuffer();
             }
             buffers.clear();
             Invoker.getInvoker().invokeOnEventThread(() -> {
-                twkRelease(arr);
+                WCGraphicsManager.getGraphicsManager().updateRefs(twkRelease(arr));
             });
             size = 0;
             if (log.isLoggable(Level.FINE)) {
@@ -161,7 +248,29 @@ public abstract class WCRenderQueue extends Ref {
         disposeGraphics();
     }
 
-    private native void twkRelease(Object[] bufs);
+    /*
+     * Returns the native reference updates, as passed to fwkAddBuffer,
+     * including the references the released buffers were holding.
+     */
+    private native Object[] twkRelease(long[] bufs);
+
+    /**
+     * Adds the decoding done by all render queues so far to a snapshot of
+     * the native counters: the Decode timer for the time spent in
+     * GraphicsDecoder, and the buffers and bytes decoded.
+     */
+    public static PerfCounters addDecodeCounters(PerfCounters counters) {
+        return counters
+                .with("Decode", decodeCount.get(), decodeNanos.get())
+                .with("RenderingQueue.decodedBuffers", decodedBufferCount.get(), 0)
+                .with("RenderingQueue.decodedBytes", decodedByteCount.get(), 0);
+    }
+
+    /*
+     * Makes the native render queues pass the objects referenced from every
+     * flushed buffer to fwkAddRecordedBuffer. Called on the Event thread.
+     */
+    static native void twkSetRecording(boolean recording);
 
     /*is called from native*/
     private int refString(String str) {
@@ -202,6 +311,11 @@ final class BufferData {
             new HashMap<>();
 
     private ByteBuffer buffer;
+    private long nativeBuffer;
+
+    /* For buffers read back by RenderQueueReplay */
+    private Map<Integer,Ref> refMap;
+    private long[][] profile;
 
     private int createID() {
         return idCount.incrementAndGet();
@@ -237,11 +351,46 @@ final class BufferData {
         return strMap.get(id);
     }
 
+    Map<Integer,String> getStrings() {
+        return strMap;
+    }
+
+    Map<Integer,int[]> getIntArrays() {
+        return intArrMap;
+    }
+
+    Map<Integer,float[]> getFloatArrays() {
+        return floatArrMap;
+    }
+
+    Ref getRef(WCGraphicsManager gm, int id) {
+        return refMap == null ? gm.getRef(id) : refMap.get(id);
+    }
+
+    /*
+     * Resolves references through refMap rather than the graphics manager,
+     * and makes GraphicsDecoder accumulate {count, time, failures} per
+     * opcode into profile.
+     */
+    void setReplay(Map<Integer,Ref> refMap, long[][] profile) {
+        this.refMap = refMap;
+        this.profile = profile;
+    }
+
+    long[][] getProfile() {
+        return profile;
+    }
+
     ByteBuffer getBuffer() {
         return buffer;
     }
 
-    void setBuffer(ByteBuffer buffer) {
+    long getNativeBuffer() {
+        return nativeBuffer;
+    }
+
+    void setBuffer(ByteBuffer buffer, long nativeBuffer) {
         this.buffer = buffer;
+        this.nativeBuffer = nativeBuffer;
     }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -32,7 +32,8 @@ import java.util.concurrent.Semaphore;
 
 /**
  * A pool of byte buffers that can be shared by multiple concurrent
- * clients.
+ * clients. The buffers wrap native data chunks, so their contents can be
+ * adopted by the native loader without being copied.
  */
 final class ByteBufferPool {
 
@@ -102,7 +103,12 @@ final class ByteBufferPool {
             semaphore.acquire();
             ByteBuffer byteBuffer = byteBuffers.poll();
             if (byteBuffer == null) {
-                byteBuffer = ByteBuffer.allocateDirect(bufferSize);
+                byteBuffer = URLLoaderBase.twkAllocateDataChunk(bufferSize);
+                if (byteBuffer == null) {
+                    semaphore.release();
+                    throw new OutOfMemoryError(
+                            "Unable to allocate native data chunk");
+                }
             }
             return byteBuffer;
         }
@@ -116,6 +122,14 @@ final class ByteBufferPool {
             byteBuffers.add(byteBuffer);
             semaphore.release();
         }
+
+        /**
+         * {@inheritDoc}
+         */
+        @Override
+        public void discard(ByteBuffer byteBuffer) {
+            semaphore.release();
+        }
     }
 }
 
@@ -133,4 +147,11 @@ interface ByteBufferAllocator {
      * Releases a byte buffer.
      */
     void release(ByteBuffer byteBuffer);
+
+    /**
+     * Releases a byte buffer whose native memory has been adopted by
+     * the native loader. The buffer is not returned to the pool and
+     * must not be used afterwards.
+     */
+    void discard(ByteBuffer byteBuffer);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -93,14 +93,6 @@ final class HTTP2Loader extends URLLoaderBase {
                 .connectTimeout(Duration.ofSeconds(30)) // FIXME: Add a property to control the timeout
                 .cookieHandler(CookieHandler.getDefault())
                 .build();
-    // Singleton instance of direct ByteBuffer to transfer downloaded bytes from
-    // Java to native
-    private static final int DEFAULT_BUFSIZE = 40 * 1024;
-    private final static ByteBuffer BUFFER;
-    static {
-       int bufSize  = Integer.valueOf(System.getProperty("jdk.httpclient.bufsize", Integer.toString(DEFAULT_BUFSIZE)));
-       BUFFER = ByteBuffer.allocateDirect(bufSize);
-    }
 
     /**
      * Creates a new {@code HTTP2Loader}.
@@ -497,35 +489,38 @@ final class HTTP2Loader extends URLLoaderBase {
         });
     }
 
-    private ByteBuffer getDirectBuffer(int size) {
-        ByteBuffer dbb = BUFFER;
-        // Though the chance of reaching here is rare, handle the
-        // case by allocating a tmp direct buffer.
-        if (size > dbb.capacity()) {
-            dbb = ByteBuffer.allocateDirect(size);
+    // Downloaded bytes are copied once into a native chunk of the exact size,
+    // which WebCore then adopts as a resource data segment.
+    private static ByteBuffer allocateDataChunk(int size) {
+        ByteBuffer chunk = twkAllocateDataChunk(size);
+        if (chunk == null) {
+            throw new OutOfMemoryError("Unable to allocate native data chunk");
         }
-        return dbb.clear();
+        return chunk;
     }
 
-    private ByteBuffer copyToDirectBuffer(final ByteBuffer bb) {
-        return getDirectBuffer(bb.limit()).put(bb).flip();
+    private ByteBuffer copyToDataChunk(final ByteBuffer bb) {
+        return allocateDataChunk(bb.remaining()).put(bb).flip();
     }
 
     // another variant to use from createZIPEncodedBodySubscriber
     private void didReceiveData(final byte[] bytes, int size) {
         callBackIfNotCanceled(() -> {
-            notifyDidReceiveData(getDirectBuffer(size).put(bytes, 0, size).flip());
+            if (size > 0) {
+                notifyDidReceiveData(allocateDataChunk(size).put(bytes, 0, size).flip());
+            }
         });
     }
 
     private void didReceiveData(final List<ByteBuffer> bytes) {
         callBackIfNotCanceled(() -> bytes.stream()
-                                          .map(this::copyToDirectBuffer)
+                                          .filter(ByteBuffer::hasRemaining)
+                                          .map(this::copyToDataChunk)
                                           .forEach(this::notifyDidReceiveData)
         );
     }
 
-    private void notifyDidReceiveData(ByteBuffer byteBuffer) {
+    private void notifyDidReceiveData(ByteBuffer chunk) {
         Invoker.getInvoker().checkEventThread();
         if (logger.isLoggable(Level.FINEST)) {
             logger.finest(String.format(
@@ -533,12 +528,14 @@ final class HTTP2Loader extends URLLoaderBase {
                     + "position: [%s], "
                     + "remaining: [%s], "
                     + "data: [0x%016X]",
-                    byteBuffer,
-                    byteBuffer.position(),
-                    byteBuffer.remaining(),
+                    chunk,
+                    chunk.position(),
+                    chunk.remaining(),
                     data));
         }
-        twkDidReceiveData(byteBuffer, byteBuffer.position(), byteBuffer.remaining(), data);
+        if (!twkDidReceiveData(chunk, chunk.position(), chunk.remaining(), data)) {
+            twkReleaseDataChunk(chunk);
+        }
     }
 
     private void didFinishLoading() {
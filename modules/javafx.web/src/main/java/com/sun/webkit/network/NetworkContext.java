@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,6 +28,9 @@ package com.sun.webkit.network;
 import static com.sun.webkit.network.URLs.newURL;
 
 import java.net.MalformedURLException;
+import java.net.Proxy;
+import java.net.ProxySelector;
+import java.net.URI;
 import java.util.Arrays;
 import java.util.concurrent.LinkedBlockingQueue;
 import java.util.concurrent.ThreadFactory;
@@ -70,6 +73,12 @@ final class NetworkContext {
      */
     private static final int BYTE_BUFFER_SIZE = 1024 * 40;
 
+    /**
+     * The URI used to ask the default proxy selector whether HTTP
+     * requests go through a proxy.
+     */
+    private static final URI PROXY_CHECK_URI = URI.create("http://example.com/");
+
     /**
      * The thread pool used to execute asynchronous loaders.
      */
@@ -219,6 +228,28 @@ final class NetworkContext {
         return propValue >= 0 ? propValue : DEFAULT_HTTP_MAX_CONNECTIONS;
     }
 
+    /**
+     * Returns {@code true} if HTTP requests may go through a proxy. Host
+     * names are then resolved by the proxy, so they are not prefetched.
+     */
+    private static boolean fwkIsUsingProxy() {
+        ProxySelector selector = ProxySelector.getDefault();
+        if (selector == null) {
+            return false;
+        }
+        try {
+            for (Proxy proxy : selector.select(PROXY_CHECK_URI)) {
+                if (proxy.type() != Proxy.Type.DIRECT) {
+                    return true;
+                }
+            }
+        } catch (RuntimeException ex) {
+            logger.finest("Proxy selection failed", ex);
+            return true;
+        }
+        return false;
+    }
+
     /**
      * Thread factory for URL loader threads.
      */
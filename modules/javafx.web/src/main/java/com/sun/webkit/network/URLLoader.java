@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -715,17 +715,19 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                                 final ByteBufferAllocator allocator)
     {
         callBack(() -> {
-            if (!canceled) {
-                notifyDidReceiveData(
-                        byteBuffer,
-                        byteBuffer.position(),
-                        byteBuffer.remaining());
+            if (!canceled && notifyDidReceiveData(
+                    byteBuffer,
+                    byteBuffer.position(),
+                    byteBuffer.remaining()))
+            {
+                allocator.discard(byteBuffer);
+            } else {
+                allocator.release(byteBuffer);
             }
-            allocator.release(byteBuffer);
         });
     }
 
-    private void notifyDidReceiveData(ByteBuffer byteBuffer,
+    private boolean notifyDidReceiveData(ByteBuffer byteBuffer,
                                       int position,
                                       int remaining)
     {
@@ -740,7 +742,7 @@ final class URLLoader extends URLLoaderBase implements Runnable {
                     remaining,
                     data));
         }
-        twkDidReceiveData(byteBuffer, position, remaining, data);
+        return twkDidReceiveData(byteBuffer, position, remaining, data);
     }
 
     private void didFinishLoading() {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -56,10 +56,30 @@ abstract class URLLoaderBase {
                                                      String url,
                                                      long data);
 
-    protected static native void twkDidReceiveData(ByteBuffer byteBuffer,
-                                                 int position,
-                                                 int remaining,
-                                                 long data);
+    /**
+     * Allocates a native data chunk of the given capacity and returns
+     * a direct byte buffer over it, or {@code null} if the native memory
+     * could not be allocated. The chunk must be passed to
+     * {@link #twkDidReceiveData} or released with
+     * {@link #twkReleaseDataChunk}.
+     */
+    protected static native ByteBuffer twkAllocateDataChunk(int capacity);
+
+    /**
+     * Frees a chunk allocated with {@link #twkAllocateDataChunk}.
+     */
+    protected static native void twkReleaseDataChunk(ByteBuffer chunk);
+
+    /**
+     * Delivers the bytes of a native data chunk to the loader. Returns
+     * {@code true} if the chunk has been adopted by the native side and
+     * must not be touched afterwards, or {@code false} if the bytes have
+     * been copied and the chunk remains owned by the caller.
+     */
+    protected static native boolean twkDidReceiveData(ByteBuffer chunk,
+                                                    int position,
+                                                    int remaining,
+                                                    long data);
 
     protected static native void twkDidFinishLoading(long data);
 
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package com.sun.webkit.perf;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+
+/**
+ * An immutable snapshot of the native performance counters, as returned by
+ * {@link com.sun.webkit.WebPage#getPerfCounters()}.
+ * <p>
+ * Each probe has a name, an invocation count and a total time. Plain counters,
+ * such as the number of bytes sent through the rendering queue, report their
+ * value as the count and a total time of zero.
+ */
+public final class PerfCounters {
+    // Mirrors the native setting for the probes kept on the java side
+    private static volatile boolean enabled;
+
+    private final String[] names;
+    private final long[] counts;
+    private final long[] nanoseconds;
+    // The probes from this index on are JNI up-call sites
+    private final int firstCallSite;
+
+    // Called from native code
+    private PerfCounters(String[] names, long[] counts, long[] nanoseconds,
+                         int firstCallSite) {
+        this.names = names;
+        this.counts = counts;
+        this.nanoseconds = nanoseconds;
+        this.firstCallSite = firstCallSite;
+    }
+
+    /**
+     * Returns whether the counters are collected, as set through
+     * {@link com.sun.webkit.WebPage#setPerfCountersEnabled(boolean)}.
+     * Probes on the java side check this before they do any work.
+     */
+    public static boolean isEnabled() {
+        return enabled;
+    }
+
+    /**
+     * Sets the java side of the setting. Only to be called by
+     * {@link com.sun.webkit.WebPage#setPerfCountersEnabled(boolean)}, which
+     * updates the native side as well.
+     */
+    public static void setEnabled(boolean value) {
+        enabled = value;
+    }
+
+    /**
+     * Returns the names of the probes in the snapshot.
+     */
+    public List<String> getNames() {
+        List<String> list = new ArrayList<>(names.length);
+        Collections.addAll(list, names);
+        return Collections.unmodifiableList(list);
+    }
+
+    /**
+     * Returns the names of the probes that count the JNI up-calls made from
+     * one place in the native code, named after the java class and method.
+     */
+    public List<String> getCallSiteNames() {
+        return getNames().subList(Math.min(firstCallSite, names.length), names.length);
+    }
+
+    private int indexOf(String name) {
+        for (int i = 0; i < names.length; i++) {
+            if (names[i].equals(name)) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * Returns the count of the probe, or zero if it has not been registered.
+     */
+    public long getCount(String name) {
+        int i = indexOf(name);
+        return i < 0 ? 0 : counts[i];
+    }
+
+    /**
+     * Returns the total time of the probe in nanoseconds, or zero if it has
+     * not been registered.
+     */
+    public long getTotalTime(String name) {
+        int i = indexOf(name);
+        return i < 0 ? 0 : nanoseconds[i];
+    }
+
+    /**
+     * Returns this snapshot with a probe kept on the java side added ahead
+     * of the JNI up-call sites.
+     */
+    public PerfCounters with(String name, long count, long nanoseconds) {
+        int n = names.length;
+        int at = Math.min(firstCallSite, n);
+        String[] nm = new String[n + 1];
+        long[] c = new long[n + 1];
+        long[] t = new long[n + 1];
+        System.arraycopy(names, 0, nm, 0, at);
+        System.arraycopy(counts, 0, c, 0, at);
+        System.arraycopy(this.nanoseconds, 0, t, 0, at);
+        nm[at] = name;
+        c[at] = count;
+        t[at] = nanoseconds;
+        System.arraycopy(names, at, nm, at + 1, n - at);
+        System.arraycopy(counts, at, c, at + 1, n - at);
+        System.arraycopy(this.nanoseconds, at, t, at + 1, n - at);
+        return new PerfCounters(nm, c, t, at + 1);
+    }
+
+    /**
+     * Returns the difference between this snapshot and an earlier one.
+     */
+    public PerfCounters since(PerfCounters earlier) {
+        long[] c = new long[names.length];
+        long[] t = new long[names.length];
+        for (int i = 0; i < names.length; i++) {
+            c[i] = counts[i] - earlier.getCount(names[i]);
+            t[i] = nanoseconds[i] - earlier.getTotalTime(names[i]);
+        }
+        return new PerfCounters(names, c, t, firstCallSite);
+    }
+
+    @Override
+    public String toString() {
+        StringBuilder buf = new StringBuilder();
+        for (int i = 0; i < names.length; i++) {
+            buf.append(String.format("%s: %d", names[i], counts[i]));
+            if (nanoseconds[i] > 0) {
+                buf.append(String.format(", %.3fms", nanoseconds[i] / 1e6));
+            }
+            buf.append('\n');
+        }
+        return buf.toString();
+    }
+}
@@ -12,6 +12,7 @@ list(APPEND WTF_PUBLIC_HEADERS
     java/JavaRef.h
     java/DbgUtils.h
     java/JavaMath.h
+    java/PerfCounters.h
     unicode/java/UnicodeJava.h
 )
 
@@ -25,6 +26,7 @@ list(APPEND WTF_SOURCES
     java/FileSystemJava.cpp
     java/JavaEnv.cpp
     java/MainThreadJava.cpp
+    java/PerfCounters.cpp
     java/StringJava.cpp
     java/TextBreakIteratorInternalICUJava.cpp
     java/CPUTimeJava.cpp
@@ -128,6 +130,7 @@ endif ()
 
 if (UNIX)
     list(APPEND WTF_SOURCES
+        posix/FileHandlePOSIX.cpp
         posix/OSAllocatorPOSIX.cpp
         posix/ThreadingPOSIX.cpp
     )
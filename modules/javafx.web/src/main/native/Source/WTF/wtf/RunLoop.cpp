@@ -229,10 +229,12 @@ void RunLoop::threadWillExit()
 }
 
 #if PLATFORM(JAVA)
+#if !USE(GENERIC_EVENT_LOOP)
 void RunLoop::dispatchFunctionsFromMainThread()
 {
     performWork();
 }
+#endif
 void RunLoop::registerTimer(TimerBase& timer)
 {
     Locker locker { m_registeredTimerLock };
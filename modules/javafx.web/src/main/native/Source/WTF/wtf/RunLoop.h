@@ -318,6 +318,11 @@ private:
     Vector<Status*> m_mainLoops;
     bool m_shutdown { false };
     bool m_pendingTasks { false };
+#if PLATFORM(JAVA)
+    std::optional<Seconds> mainThreadWakeUpDelayWithLock() WTF_REQUIRES_LOCK(m_loopLock);
+    void scheduleMainThreadWakeUp() WTF_EXCLUDES_LOCK(m_loopLock);
+    MonotonicTime m_mainThreadWakeUpTime WTF_GUARDED_BY_LOCK(m_loopLock) { MonotonicTime::infinity() };
+#endif
 #endif
 
 #if USE(GENERIC_EVENT_LOOP) || USE(WINDOWS_EVENT_LOOP)
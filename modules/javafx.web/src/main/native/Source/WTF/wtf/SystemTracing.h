@@ -198,6 +198,12 @@ enum TracePointCode {
 
 namespace WTF {
 
+#if PLATFORM(JAVA)
+namespace PerfCounters {
+WTF_EXPORT_PRIVATE void tracePoint(TracePointCode);
+}
+#endif
+
 inline void tracePoint(TracePointCode code, uint64_t data1 = 0, uint64_t data2 = 0, uint64_t data3 = 0, uint64_t data4 = 0)
 {
 #if HAVE(KDEBUG_H)
@@ -209,6 +215,12 @@ inline void tracePoint(TracePointCode code, uint64_t data1 = 0, uint64_t data2 =
     UNUSED_PARAM(data2);
     UNUSED_PARAM(data3);
     UNUSED_PARAM(data4);
+#elif PLATFORM(JAVA)
+    PerfCounters::tracePoint(code);
+    UNUSED_PARAM(data1);
+    UNUSED_PARAM(data2);
+    UNUSED_PARAM(data3);
+    UNUSED_PARAM(data4);
 #else
     UNUSED_PARAM(code);
     UNUSED_PARAM(data1);
@@ -269,9 +269,60 @@ void RunLoop::wakeUpWithLock()
 
 void RunLoop::wakeUp()
 {
-    Locker locker { m_loopLock };
-    wakeUpWithLock();
+    {
+        Locker locker { m_loopLock };
+        wakeUpWithLock();
+    }
+#if PLATFORM(JAVA)
+    scheduleMainThreadWakeUp();
+#endif
+}
+
+#if PLATFORM(JAVA)
+// Nothing runs the main run loop on the Java port: the Java event thread
+// is the main thread, so its timers are fired from there, through the same
+// path as the functions dispatched to the main thread.
+std::optional<Seconds> RunLoop::mainThreadWakeUpDelayWithLock()
+{
+    if (m_schedules.isEmpty())
+        return std::nullopt;
+
+    MonotonicTime fireTime = m_schedules.first()->scheduledTimePoint();
+    if (fireTime >= m_mainThreadWakeUpTime)
+        return std::nullopt;
+
+    m_mainThreadWakeUpTime = fireTime;
+    return std::max(fireTime - MonotonicTime::now(), 0_s);
+}
+
+// The wake-up is an up-call into Java, so it is made without holding
+// m_loopLock. The Java side keeps the earliest of the wake-ups it is asked
+// for, which makes the order of concurrent calls irrelevant.
+void RunLoop::scheduleMainThreadWakeUp()
+{
+    if (this != &RunLoop::mainSingleton())
+        return;
+
+    std::optional<Seconds> delay;
+    {
+        Locker locker { m_loopLock };
+        delay = mainThreadWakeUpDelayWithLock();
+    }
+    if (delay)
+        scheduleDispatchFunctionsOnMainThread(*delay);
+}
+
+void RunLoop::dispatchFunctionsFromMainThread()
+{
+    {
+        Locker locker { m_loopLock };
+        m_mainThreadWakeUpTime = MonotonicTime::infinity();
+    }
+
+    runImpl(RunMode::Iterate);
+    scheduleMainThreadWakeUp();
 }
+#endif
 
 RunLoop::CycleResult RunLoop::cycle(RunLoopMode)
 {
@@ -312,11 +363,16 @@ RunLoop::TimerBase::~TimerBase()
 
 void RunLoop::TimerBase::start(Seconds interval, bool repeating)
 {
-    Locker locker { m_runLoop->m_loopLock };
-    stopWithLock();
-    m_scheduledTask->activate(interval, repeating);
-    m_runLoop->scheduleWithLock(m_scheduledTask.get());
-    m_runLoop->wakeUpWithLock();
+    {
+        Locker locker { m_runLoop->m_loopLock };
+        stopWithLock();
+        m_scheduledTask->activate(interval, repeating);
+        m_runLoop->scheduleWithLock(m_scheduledTask.get());
+        m_runLoop->wakeUpWithLock();
+    }
+#if PLATFORM(JAVA)
+    m_runLoop->scheduleMainThreadWakeUp();
+#endif
 }
 
 void RunLoop::TimerBase::stopWithLock()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,8 @@
 #if OS(WINDOWS)
     #include <windows.h>
 #else
+    #include <fcntl.h>
+    #include <sys/file.h>
     #include <sys/types.h>
     #include <sys/stat.h>
     #include <unistd.h>
@@ -238,11 +240,13 @@ bool makeAllDirectories(const String& path)
 }
 
 
+// Paths are handed to the native file APIs, openFile included, as UTF-8.
 CString fileSystemRepresentation(const String& s)
 {
-    return CString(s.latin1().data());
+    return s.utf8();
 }
 
+#if !OS(UNIX)
 FileHandle openFile(const String& path, FileOpenMode mode, FileAccessPermission, OptionSet<FileLockMode> , bool failIfFileExists)
 {
     if (mode != FileOpenMode::Read) {
@@ -358,6 +362,84 @@ std::optional<uint64_t> FileHandle::size()
    return {};
 }
 
+#else
+// On Unix the files are accessed natively, through the POSIX FileHandle
+// implementation, once the Java side has allowed the access.
+static bool canOpenFile(const String& path, FileOpenMode mode)
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkCanOpenFile",
+            "(Ljava/lang/String;Z)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)path.toJavaString(env),
+            bool_to_jbool(mode != FileOpenMode::Read));
+    if (WTF::CheckAndClearException(env)) {
+        return false;
+    }
+
+    return jbool_to_bool(result);
+}
+
+FileHandle openFile(const String& path, FileOpenMode mode, FileAccessPermission permission, OptionSet<FileLockMode> lockMode, bool failIfFileExists)
+{
+    if (!canOpenFile(path, mode)) {
+        return FileHandle::adopt(invalidPlatformFileHandle);
+    }
+
+    CString fsRep = fileSystemRepresentation(path);
+    if (fsRep.isNull()) {
+        return FileHandle::adopt(invalidPlatformFileHandle);
+    }
+
+    int platformFlag = O_CLOEXEC;
+    switch (mode) {
+    case FileOpenMode::Read:
+        platformFlag |= O_RDONLY;
+        break;
+    case FileOpenMode::Truncate:
+        platformFlag |= (O_WRONLY | O_CREAT | O_TRUNC);
+        break;
+    case FileOpenMode::ReadWrite:
+        platformFlag |= (O_RDWR | O_CREAT);
+        break;
+#if OS(DARWIN)
+    case FileOpenMode::EventsOnly:
+        platformFlag |= O_EVTONLY;
+        break;
+#endif
+    }
+
+    if (failIfFileExists) {
+        platformFlag |= (O_CREAT | O_EXCL);
+    }
+
+    int permissionFlag = 0;
+    if (permission == FileAccessPermission::User) {
+        permissionFlag |= (S_IRUSR | S_IWUSR);
+    } else if (permission == FileAccessPermission::All) {
+        permissionFlag |= (S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH);
+    }
+
+    int handle = open(fsRep.data(), platformFlag, permissionFlag);
+    // Unlike FileHandle's own locking, a lock that cannot be taken fails
+    // the open, so that a Nonblocking caller can tell it lost the race.
+    static_assert(LOCK_SH == WTF::enumToUnderlyingType(FileLockMode::Shared));
+    static_assert(LOCK_EX == WTF::enumToUnderlyingType(FileLockMode::Exclusive));
+    static_assert(LOCK_NB == WTF::enumToUnderlyingType(FileLockMode::Nonblocking));
+    if (handle != -1 && lockMode && flock(handle, lockMode.toRaw()) == -1) {
+        ::close(handle);
+        return FileHandle::adopt(invalidPlatformFileHandle);
+    }
+    return FileHandle::adopt(handle);
+}
+#endif
 
 String pathFileName(const String& path)
 {
@@ -378,6 +460,7 @@ String pathFileName(const String& path)
     return String(env, result);
 }
 
+#if !OS(UNIX)
 long long seekFile(PlatformFileHandle handle, long long offset, FileSeekOrigin)
 {
     // we always get positive value for offset from webkit.
@@ -411,6 +494,7 @@ std::optional<uint64_t> FileHandle::seek(int64_t offset, FileSeekOrigin origin)
 
     return static_cast<uint64_t>(pos);
 }
+#endif
 
 // -----------------------------------------------------------------------
 // Below methods are stubs as of now.
@@ -442,11 +526,34 @@ Vector<String> listDirectory(const String&, const String&)
     return entities;
 }
 
-Vector<String> listDirectory(const String&)
+Vector<String> listDirectory(const String& path)
 {
-    fprintf(stderr, "listDirectory(const String&) NOT IMPLEMENTED\n");
-    Vector<String> entities;
-    return entities;
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkListDirectory",
+            "(Ljava/lang/String;)[Ljava/lang/String;");
+    ASSERT(mid);
+
+    JLObjectArray names(static_cast<jobjectArray>(env->CallStaticObjectMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)path.toJavaString(env))));
+    if (WTF::CheckAndClearException(env) || !names) {
+        return { };
+    }
+
+    jsize count = env->GetArrayLength(names);
+    Vector<String> entries;
+    entries.reserveInitialCapacity(count);
+    for (jsize i = 0; i < count; ++i) {
+        JLString name(static_cast<jstring>(env->GetObjectArrayElement(names, i)));
+        if (name) {
+            entries.append(String(env, name));
+        }
+    }
+    return entries;
 }
 
 int writeToFile(PlatformFileHandle, const void* data, int length)
@@ -481,10 +588,25 @@ bool unmapViewOfFile(void* , size_t)
 }
 
 
-bool deleteFile(const String&)
+bool deleteFile(const String& path)
 {
-    fprintf(stderr, "deleteFile(const String&) NOT IMPLEMENTED\n");
-    return false;
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkDeleteFile",
+            "(Ljava/lang/String;)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)path.toJavaString(env));
+    if (WTF::CheckAndClearException(env)) {
+        return false;
+    }
+
+    return jbool_to_bool(result);
 }
 
 bool deleteEmptyDirectory(String const &)
@@ -510,11 +632,24 @@ String parentPath(const String& path)
 
 bool moveFile(const String& oldPath, const String& newPath)
 {
-    fprintf(stderr, "moveFile(const String& oldPath, const String& newPath) NOT IMPLEMENTED\n");
-    UNUSED_PARAM(oldPath);
-    UNUSED_PARAM(newPath);
+    JNIEnv* env = WTF::GetJavaEnv();
 
-    return false;
+    static jmethodID mid = env->GetStaticMethodID(
+            comSunWebkitFileSystem,
+            "fwkMoveFile",
+            "(Ljava/lang/String;Ljava/lang/String;)Z");
+    ASSERT(mid);
+
+    jboolean result = env->CallStaticBooleanMethod(
+            comSunWebkitFileSystem,
+            mid,
+            (jstring)oldPath.toJavaString(env),
+            (jstring)newPath.toJavaString(env));
+    if (WTF::CheckAndClearException(env)) {
+        return false;
+    }
+
+    return jbool_to_bool(result);
 }
 
 bool isHiddenFile(const String& path)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -43,67 +43,33 @@ bool CheckAndClearException(JNIEnv* env)
     return false;
 }
 
+namespace {
 
-jclass PL_GetClass(JNIEnv* env)
-{
-    static JGClass cls(
-        env->FindClass("com/sun/webkit/perf/PerfLogger"));
-    return cls;
-}
-
-JLObject PL_GetLogger(JNIEnv* env, const char* name)
-{
-    static jmethodID mid =
-        env->GetStaticMethodID(PL_GetClass(env),
-            "getLogger",
-            "(Ljava/lang/String;)Lcom/sun/webkit/perf/PerfLogger;");
-    ASSERT(mid);
-
-    JLObject jlogger(env->CallStaticObjectMethod(PL_GetClass(env), mid,
-        (jstring)JLString(env->NewStringUTF(name))));
-    CheckAndClearException(env);
-
-    return jlogger;
-}
-
-void PL_ResumeCount(JNIEnv* env, jobject perfLogger, const char* probe)
-{
-    static jmethodID mid =
-        env->GetMethodID(PL_GetClass(env),
-            "resumeCount",
-            "(Ljava/lang/String;)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(perfLogger, mid,
-        (jstring)JLString(env->NewStringUTF(probe)));
-    CheckAndClearException(env);
-}
+class ThreadDetacher {
+public:
+    ~ThreadDetacher()
+    {
+        if (jvm && !g_ShuttingDown)
+            jvm->DetachCurrentThread();
+    }
+};
 
-void PL_SuspendCount(JNIEnv* env, jobject perfLogger, const char* probe)
-{
-    static jmethodID mid =
-        env->GetMethodID(PL_GetClass(env),
-            "suspendCount",
-            "(Ljava/lang/String;)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(perfLogger, mid,
-        (jstring)JLString(env->NewStringUTF(probe)));
-    CheckAndClearException(env);
-}
+} // namespace
 
-bool PL_IsEnabled(JNIEnv* env, jobject perfLogger)
+JNIEnv* GetJavaEnvAttachingThread()
 {
-    static jmethodID mid =
-        env->GetMethodID(PL_GetClass(env),
-            "isEnabled",
-            "()Z");
-    ASSERT(mid);
-
-    static jboolean isEnabled = env->CallBooleanMethod(perfLogger, mid);
-    CheckAndClearException(env);
-
-    return isEnabled;
+    if (g_ShuttingDown)
+        return nullptr;
+
+    JNIEnv* env = nullptr;
+    jint status = jvm->GetEnv((void**)&env, JNI_VERSION_1_2);
+    if (status == JNI_EDETACHED) {
+        if (jvm->AttachCurrentThreadAsDaemon((void**)&env, nullptr) != JNI_OK)
+            return nullptr;
+        static thread_local ThreadDetacher detacher;
+        return env;
+    }
+    return status == JNI_OK ? env : nullptr;
 }
 
 } // namespace WTF
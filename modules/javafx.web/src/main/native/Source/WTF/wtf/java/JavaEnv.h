@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 #pragma once
 
 #include <wtf/java/JavaRef.h>
+#include <wtf/java/PerfCounters.h>
 
 #include <jni.h>
 
@@ -47,35 +48,12 @@ ALWAYS_INLINE JNIEnv* JNICALL GetJavaEnv()
 
 bool CheckAndClearException(JNIEnv* env);
 
-JLObject PL_GetLogger(JNIEnv* env, const char* name);
-void PL_ResumeCount(JNIEnv* env, jobject perfLogger, const char* probe);
-void PL_SuspendCount(JNIEnv* env, jobject perfLogger, const char* probe);
-bool PL_IsEnabled(JNIEnv* env, jobject perfLogger);
-
-//Log wrapper
-struct EntryJavaLogger
-{
-    JNIEnv     *m_env;
-    jobject     m_perfLogger;
-    const char *m_probe;
-
-    EntryJavaLogger(
-         JNIEnv *env,
-         jobject global_perfLogger,
-         const char* probe
-    ) : m_env(env)
-      , m_perfLogger(global_perfLogger)
-      , m_probe(probe)
-    {
-        PL_ResumeCount(m_env, m_perfLogger, m_probe);
-    }
-
-    ~EntryJavaLogger()
-    {
-        PL_SuspendCount(m_env, m_perfLogger, m_probe);
-    }
-};
-
+// Returns the env of the calling thread, attaching it to the VM as a daemon
+// if it is not attached yet. Unlike AttachThreadToJavaEnv, the thread stays
+// attached until it exits, so that worker threads that call into Java
+// repeatedly attach only once, and the global references they release
+// between the calls are still deleted.
+JNIEnv* GetJavaEnvAttachingThread();
 
 } // namespace WTF
 
@@ -117,14 +95,6 @@ using AttachThreadAsDaemonToJavaEnv = AttachThreadToJavaEnv<true>;
 using AttachThreadAsNonDaemonToJavaEnv = AttachThreadToJavaEnv<false>;
 } // namespace
 
-//example: LOG_PERF_RECORD(env, "XXXX", "setUpIterator")
-//the line
-//  com.sun.webkit.perf.XXXX.level = ALL
-//have to be added into the file <wk_root>/WebKitBuild/<Debug|Release>/dist/logging.properties
-#define LOG_PERF_RECORD(env, LOG_NAME, LOG_RECORD) \
-    static JGObject __logger__(WTF::PL_GetLogger(env, LOG_NAME)); \
-    WTF::EntryJavaLogger __el__(env, __logger__, LOG_RECORD);
-
 #define jlong_to_ptr(a) ((void*)(uintptr_t)(a))
 #define ptr_to_jlong(a) ((jlong)(uintptr_t)(a))
 
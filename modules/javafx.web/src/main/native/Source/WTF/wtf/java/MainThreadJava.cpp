@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,7 @@
 #include <wtf/java/JavaRef.h>
 #include <wtf/MainThread.h>
 #include <wtf/RunLoop.h>
+#include <wtf/Seconds.h>
 
 #if OS(UNIX)
 #include <pthread.h>
@@ -37,6 +38,7 @@
 namespace WTF {
 static JGClass jMainThreadCls;
 static jmethodID fwkScheduleDispatchFunctions;
+static jmethodID fwkScheduleDispatchFunctionsAfter;
 
 #if OS(UNIX)
 static pthread_t s_mainThread;
@@ -49,11 +51,26 @@ void scheduleDispatchFunctionsOnMainThread()
     AttachThreadAsNonDaemonToJavaEnv autoAttach;
     JNIEnv* env = autoAttach.env();
     if (env) {
+        LOG_PERF_RECORD("MainThread", "fwkScheduleDispatchFunctions");
         env->CallStaticVoidMethod(jMainThreadCls, fwkScheduleDispatchFunctions);
         WTF::CheckAndClearException(env);
     }
 }
 
+void scheduleDispatchFunctionsOnMainThread(Seconds delay)
+{
+    if (!fwkScheduleDispatchFunctionsAfter)
+        return;
+
+    AttachThreadAsNonDaemonToJavaEnv autoAttach;
+    JNIEnv* env = autoAttach.env();
+    if (env) {
+        LOG_PERF_RECORD("MainThread", "fwkScheduleDispatchFunctionsAfter");
+        env->CallStaticVoidMethod(jMainThreadCls, fwkScheduleDispatchFunctionsAfter, delay.value());
+        WTF::CheckAndClearException(env);
+    }
+}
+
 void initializeMainThreadPlatform()
 {
     // Initialize the class reference and methodids for the MainThread. The
@@ -88,6 +105,13 @@ void initializeMainThreadPlatform()
 
     ASSERT(fwkScheduleDispatchFunctions);
 
+    fwkScheduleDispatchFunctionsAfter = env->GetStaticMethodID(
+            jMainThreadCls,
+            "fwkScheduleDispatchFunctionsAfter",
+            "(D)V");
+
+    ASSERT(fwkScheduleDispatchFunctionsAfter);
+
 #if OS(UNIX)
     s_mainThread = pthread_self();
 #elif OS(WINDOWS)
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+*/
+#include "config.h"
+#include <wtf/java/PerfCounters.h>
+
+#include <array>
+#include <atomic>
+#include <utility>
+#include <wtf/SystemTracing.h>
+
+namespace WTF {
+namespace PerfCounters {
+
+namespace {
+
+constexpr unsigned SlotCount = TimerCount + MaxCallSites;
+constexpr unsigned InvalidSlot = SlotCount;
+
+const char* const s_counterNames[CounterCount] = {
+    "RenderingQueue.bytes",
+    "RenderingQueue.buffers",
+    "RenderingQueue.flushes",
+    "RenderingQueue.poolHits",
+    "RenderingQueue.poolMisses",
+    "RenderingQueue.trackedCommands",
+    "RenderingQueue.elidedCommands",
+    "RenderingQueue.elidedBytes",
+    "RQRef.assigned",
+    "RQRef.released",
+    "BytecodeCache.hits",
+    "BytecodeCache.misses",
+    "BytecodeCache.commits",
+    "Compositing.textureAllocations",
+    "Compositing.textureReuses",
+    "Compositing.textureUpdatedPixels",
+    "Compositing.frames",
+    "Compositing.paintedPixels",
+    "DNSPrefetch.lookups",
+    "DNSPrefetch.completed",
+    "DNSPrefetch.failures",
+    "DNSPrefetch.hits",
+    "DNSPrefetch.misses",
+};
+
+const char* const s_timerNames[TimerCount] = {
+    "StyleRecalc",
+    "Layout",
+    "Paint",
+    "ImageDecode",
+    "Parse",
+};
+
+struct ThreadBlock {
+    std::array<std::atomic<uint64_t>, CounterCount> counters { };
+    std::array<std::atomic<uint64_t>, SlotCount> counts { };
+    std::array<std::atomic<uint64_t>, SlotCount> nanoseconds { };
+    // Only accessed by the owning thread.
+    std::array<unsigned, TimerCount> depth { };
+    std::array<MonotonicTime, TimerCount> start { };
+    unsigned generation { 0 };
+    std::atomic<bool> inUse { true };
+    ThreadBlock* next { nullptr };
+};
+
+std::atomic<ThreadBlock*> s_blocks { nullptr };
+// Bumped by setEnabled, so that threads drop the timers they had open.
+std::atomic<unsigned> s_generation { 0 };
+std::atomic<unsigned> s_callSiteCount { 0 };
+std::array<std::atomic<const char*>, MaxCallSites> s_callSiteNames { };
+
+ThreadBlock* claimBlock()
+{
+    for (auto* block = s_blocks.load(std::memory_order_acquire); block; block = block->next) {
+        bool inUse = false;
+        if (block->inUse.compare_exchange_strong(inUse, true, std::memory_order_acquire)) {
+            // The previous owner may have exited inside a timer scope.
+            block->depth = { };
+            return block;
+        }
+    }
+
+    // Blocks are never freed, so the list can be walked without a lock.
+    auto* block = new ThreadBlock;
+    block->next = s_blocks.load(std::memory_order_relaxed);
+    while (!s_blocks.compare_exchange_weak(block->next, block, std::memory_order_release, std::memory_order_relaxed)) { }
+    return block;
+}
+
+// Trivially destructible, so still usable from the destructors of other
+// thread locals that run after the block has been given back.
+thread_local ThreadBlock* t_block { nullptr };
+thread_local bool t_blockReleased { false };
+
+class ThreadBlockReleaser {
+public:
+    ~ThreadBlockReleaser()
+    {
+        if (auto* block = std::exchange(t_block, nullptr))
+            block->inUse.store(false, std::memory_order_release);
+        t_blockReleased = true;
+    }
+};
+
+// Returns null once the thread has given its block back, which makes any
+// later recording on the exiting thread a no-op.
+ThreadBlock* currentBlock()
+{
+    if (!t_block && !t_blockReleased) {
+        static thread_local ThreadBlockReleaser releaser;
+        t_block = claimBlock();
+    }
+    return t_block;
+}
+
+// Returns the block of the thread for timing, with the timers reset if the
+// setting changed since the thread last timed anything.
+ThreadBlock* currentTimerBlock()
+{
+    auto* block = currentBlock();
+    if (!block)
+        return nullptr;
+    unsigned generation = s_generation.load(std::memory_order_relaxed);
+    if (block->generation != generation) {
+        block->depth = { };
+        block->generation = generation;
+    }
+    return block;
+}
+
+// Each value has a single writer, so there is no need for an atomic add.
+inline void bump(std::atomic<uint64_t>& value, uint64_t delta)
+{
+    value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+}
+
+} // namespace
+
+std::atomic<bool> s_enabled { false };
+
+void setEnabled(bool enabled)
+{
+    if (s_enabled.exchange(enabled, std::memory_order_relaxed) != enabled)
+        s_generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+CallSite::CallSite(const char* name)
+{
+    unsigned index = s_callSiteCount.fetch_add(1, std::memory_order_relaxed);
+    if (index >= MaxCallSites) {
+        ASSERT_NOT_REACHED();
+        m_slot = InvalidSlot;
+        return;
+    }
+    s_callSiteNames[index].store(name, std::memory_order_release);
+    m_slot = TimerCount + index;
+}
+
+void addSlowCase(Counter counter, uint64_t value)
+{
+    if (auto* block = currentBlock())
+        bump(block->counters[static_cast<unsigned>(counter)], value);
+}
+
+void beginSlowCase(Timer timer)
+{
+    auto* block = currentTimerBlock();
+    if (!block)
+        return;
+    unsigned index = static_cast<unsigned>(timer);
+    if (!block->depth[index]++)
+        block->start[index] = MonotonicTime::now();
+}
+
+void endSlowCase(Timer timer)
+{
+    auto* block = currentTimerBlock();
+    if (!block)
+        return;
+    unsigned index = static_cast<unsigned>(timer);
+    if (!block->depth[index] || --block->depth[index])
+        return;
+    bump(block->counts[index], 1);
+    bump(block->nanoseconds[index], static_cast<uint64_t>((MonotonicTime::now() - block->start[index]).nanoseconds()));
+}
+
+void record(const CallSite& site, Seconds duration)
+{
+    if (site.slot() == InvalidSlot)
+        return;
+    auto* block = currentBlock();
+    if (!block)
+        return;
+    bump(block->counts[site.slot()], 1);
+    bump(block->nanoseconds[site.slot()], static_cast<uint64_t>(duration.nanoseconds()));
+}
+
+void tracePoint(TracePointCode code)
+{
+    if (!isEnabled())
+        return;
+
+    switch (code) {
+    case StyleRecalcStart:
+        begin(Timer::StyleRecalc);
+        break;
+    case StyleRecalcEnd:
+        end(Timer::StyleRecalc);
+        break;
+    case PerformLayoutStart:
+        begin(Timer::Layout);
+        break;
+    case PerformLayoutEnd:
+        end(Timer::Layout);
+        break;
+    case AsyncImageDecodeStart:
+        begin(Timer::ImageDecode);
+        break;
+    case AsyncImageDecodeEnd:
+        end(Timer::ImageDecode);
+        break;
+    case ParseHTMLStart:
+        begin(Timer::Parse);
+        break;
+    case ParseHTMLEnd:
+        end(Timer::Parse);
+        break;
+    default:
+        break;
+    }
+}
+
+Vector<Entry> snapshot()
+{
+    unsigned callSiteCount = std::min(s_callSiteCount.load(std::memory_order_relaxed), MaxCallSites);
+
+    std::array<uint64_t, CounterCount> counters { };
+    std::array<uint64_t, SlotCount> counts { };
+    std::array<uint64_t, SlotCount> nanoseconds { };
+    for (auto* block = s_blocks.load(std::memory_order_acquire); block; block = block->next) {
+        for (unsigned i = 0; i < CounterCount; ++i)
+            counters[i] += block->counters[i].load(std::memory_order_relaxed);
+        for (unsigned i = 0; i < TimerCount + callSiteCount; ++i) {
+            counts[i] += block->counts[i].load(std::memory_order_relaxed);
+            nanoseconds[i] += block->nanoseconds[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    Vector<Entry> entries;
+    entries.reserveInitialCapacity(CounterCount + TimerCount + callSiteCount);
+    for (unsigned i = 0; i < CounterCount; ++i)
+        entries.append({ s_counterNames[i], counters[i], 0 });
+    for (unsigned i = 0; i < TimerCount; ++i)
+        entries.append({ s_timerNames[i], counts[i], nanoseconds[i] });
+    for (unsigned i = 0; i < callSiteCount; ++i) {
+        // Skip a site that is still being registered by another thread.
+        if (auto* name = s_callSiteNames[i].load(std::memory_order_acquire))
+            entries.append({ name, counts[TimerCount + i], nanoseconds[TimerCount + i] });
+    }
+    return entries;
+}
+
+} // namespace PerfCounters
+} // namespace WTF
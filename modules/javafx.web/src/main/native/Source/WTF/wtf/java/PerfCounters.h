@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <wtf/MonotonicTime.h>
+#include <wtf/Noncopyable.h>
+#include <wtf/Vector.h>
+
+namespace WTF {
+namespace PerfCounters {
+
+// Native replacement for the com.sun.webkit.perf.PerfLogger JNI probes.
+// Every thread accumulates into its own block of counters with plain relaxed
+// stores, so recording never takes a lock or crosses into Java. The blocks
+// are only summed up when a snapshot is taken, and the block of a thread
+// that exits is handed to the next new thread so no totals are lost.
+//
+// Nothing is recorded until the counters are enabled with setEnabled. Every
+// probe checks that first, so a disabled probe costs a single branch.
+
+enum class Counter : uint8_t {
+    RenderingQueueBytes,
+    RenderingQueueBuffers,
+    RenderingQueueFlushes,
+    // Buffers taken from the native pool, and those it had to allocate.
+    RenderingQueuePoolHits,
+    RenderingQueuePoolMisses,
+    // Commands the rendering queue state tracker looked at, and those of
+    // them it dropped or merged, with their size.
+    RenderingQueueTrackedCommands,
+    RenderingQueueElidedCommands,
+    RenderingQueueElidedBytes,
+    // Java references given an id by the native RQRef table, and released.
+    RQRefAssigned,
+    RQRefReleased,
+    // Bytecode cache entries found and not found, and the ones written.
+    BytecodeCacheHits,
+    BytecodeCacheMisses,
+    BytecodeCacheCommits,
+    // Composited layer textures allocated and reused, and the pixels
+    // uploaded to them.
+    CompositingTextureAllocations,
+    CompositingTextureReuses,
+    CompositingTextureUpdatedPixels,
+    // Composited frames, and the page pixels painted for them.
+    CompositingFrames,
+    CompositingPaintedPixels,
+    // Host names looked up by the DNS prefetcher, and the lookups that
+    // completed or failed. Requests served from its cache are hits.
+    DNSPrefetchLookups,
+    DNSPrefetchCompleted,
+    DNSPrefetchFailures,
+    DNSPrefetchHits,
+    DNSPrefetchMisses,
+};
+constexpr unsigned CounterCount = 23;
+
+enum class Timer : uint8_t {
+    StyleRecalc,
+    Layout,
+    Paint,
+    ImageDecode,
+    Parse,
+};
+constexpr unsigned TimerCount = 5;
+
+constexpr unsigned MaxCallSites = 128;
+
+// A JNI up-call site, registered on first use. Declare it as a function
+// static; see LOG_PERF_RECORD.
+class CallSite {
+    WTF_MAKE_NONCOPYABLE(CallSite);
+public:
+    WTF_EXPORT_PRIVATE explicit CallSite(const char* name);
+
+    unsigned slot() const { return m_slot; }
+
+private:
+    unsigned m_slot;
+};
+
+WTF_EXPORT_PRIVATE extern std::atomic<bool> s_enabled;
+
+inline bool isEnabled()
+{
+    return s_enabled.load(std::memory_order_relaxed);
+}
+
+// Timers left open by a change of the setting are dropped.
+WTF_EXPORT_PRIVATE void setEnabled(bool);
+
+WTF_EXPORT_PRIVATE void addSlowCase(Counter, uint64_t value);
+// Timers nest: only the outermost begin/end pair of a thread is counted.
+WTF_EXPORT_PRIVATE void beginSlowCase(Timer);
+WTF_EXPORT_PRIVATE void endSlowCase(Timer);
+WTF_EXPORT_PRIVATE void record(const CallSite&, Seconds duration);
+
+inline void add(Counter counter, uint64_t value = 1)
+{
+    if (isEnabled())
+        addSlowCase(counter, value);
+}
+
+inline void begin(Timer timer)
+{
+    if (isEnabled())
+        beginSlowCase(timer);
+}
+
+inline void end(Timer timer)
+{
+    if (isEnabled())
+        endSlowCase(timer);
+}
+
+class TimerScope {
+    WTF_MAKE_NONCOPYABLE(TimerScope);
+public:
+    explicit TimerScope(Timer timer)
+        : m_timer(timer)
+    {
+        begin(m_timer);
+    }
+
+    ~TimerScope()
+    {
+        end(m_timer);
+    }
+
+private:
+    Timer m_timer;
+};
+
+class CallScope {
+    WTF_MAKE_NONCOPYABLE(CallScope);
+public:
+    explicit CallScope(const CallSite& site)
+        : m_site(site)
+        , m_enabled(isEnabled())
+    {
+        if (m_enabled)
+            m_start = MonotonicTime::now();
+    }
+
+    ~CallScope()
+    {
+        if (m_enabled)
+            record(m_site, MonotonicTime::now() - m_start);
+    }
+
+private:
+    const CallSite& m_site;
+    bool m_enabled;
+    MonotonicTime m_start;
+};
+
+struct Entry {
+    const char* name;
+    uint64_t count;
+    uint64_t nanoseconds;
+};
+
+// Counters report their value as the count and no time. The first
+// CounterCount entries are the counters, then come the TimerCount timers,
+// and the JNI up-call sites follow.
+WTF_EXPORT_PRIVATE Vector<Entry> snapshot();
+
+} // namespace PerfCounters
+} // namespace WTF
+
+// Counts and times the JNI up-call made in the rest of the enclosing scope,
+// e.g. LOG_PERF_RECORD("WCRenderQueue", "fwkFlush").
+#define LOG_PERF_RECORD(LOG_NAME, LOG_RECORD) \
+    static WTF::PerfCounters::CallSite __perfCallSite__(LOG_NAME "." LOG_RECORD); \
+    WTF::PerfCounters::CallScope __perfCallScope__(__perfCallSite__);
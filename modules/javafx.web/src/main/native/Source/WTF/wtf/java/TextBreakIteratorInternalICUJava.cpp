@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2017, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,9 @@
 
 #include "TextBreakIteratorInternalICU.h"
 
+#include <mutex>
+#include <wtf/Language.h>
+#include <wtf/NeverDestroyed.h>
 #include <wtf/StdLibExtras.h>
 #include <wtf/text/WTFString.h>
 #include <wtf/text/CString.h>
@@ -36,11 +39,15 @@ namespace WTF {
 
 static const char* UILanguage()
 {
-    // Chrome's UI language can be different from the OS UI language on Windows.
-    // We want to return Chrome's UI language here.
-    // DEPRECATED_DEFINE_STATIC_LOCAL(CString, locale, (WebCore::defaultLanguage().latin1()));
-    // FIXME-java: Get default language from Java using Locale.getDefault()
-    return "en";
+    // ICU break iterators are cached per locale by TextBreakIteratorCache,
+    // so the locale is resolved once; ICU accepts BCP 47 style "en-US" ids.
+    static LazyNeverDestroyed<CString> locale;
+    static std::once_flag onceKey;
+    std::call_once(onceKey, [] {
+        String language = defaultLanguage();
+        locale.construct(language.isEmpty() ? CString("en") : language.latin1());
+    });
+    return locale->data();
 }
 
 const char* currentSearchLocaleID()
@@ -53,4 +60,4 @@ const char* currentTextBreakLocaleID()
     return UILanguage();
 }
 
-} // namespace WebCore
+} // namespace WTF
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -24,72 +24,287 @@
  */
 
 #include "config.h"
-
 #include "CryptoDigest.h"
-#include <jni.h>
-#include <wtf/java/JavaEnv.h>
-#include <wtf/java/JavaRef.h>
+
+#include <array>
+#include <variant>
+#include <wtf/SHA1.h>
+#include <wtf/StdLibExtras.h>
+
+#if CPU(X86_64) && COMPILER(GCC_COMPATIBLE)
+#define HAVE_SHA_NI_INTRINSICS 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
 
 namespace PAL {
 
 namespace CryptoDigestInternal {
 
-inline jclass GetMessageDigestClass(JNIEnv* env)
+template<typename Word>
+static inline Word rotateRight(Word value, unsigned bits)
+{
+    return (value >> bits) | (value << (sizeof(Word) * 8 - bits));
+}
+
+template<typename Word>
+static inline Word loadBigEndian(std::span<const uint8_t> bytes)
 {
-    static JGClass messageDigestCls(
-        env->FindClass("com/sun/webkit/security/WCMessageDigest"));
-    ASSERT(messageDigestCls);
-    return messageDigestCls;
+    Word value = 0;
+    for (size_t i = 0; i < sizeof(Word); ++i)
+        value = (value << 8) | bytes[i];
+    return value;
 }
 
-inline JLObject GetMessageDigestInstance(jstring algorithm)
+template<typename Word>
+static inline void storeBigEndian(Word value, std::span<uint8_t> bytes)
 {
-    JNIEnv* env = WTF::GetJavaEnv();
-    if (!env) {
-        return { };
+    for (size_t i = sizeof(Word); i--;) {
+        bytes[i] = static_cast<uint8_t>(value);
+        value >>= 8;
     }
+}
+
+static constexpr std::array<uint32_t, 64> sha256RoundConstants {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+static constexpr std::array<uint64_t, 80> sha512RoundConstants {
+    0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc, 0x3956c25bf348b538,
+    0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118, 0xd807aa98a3030242, 0x12835b0145706fbe,
+    0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2, 0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235,
+    0xc19bf174cf692694, 0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
+    0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5, 0x983e5152ee66dfab,
+    0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4, 0xc6e00bf33da88fc2, 0xd5a79147930aa725,
+    0x06ca6351e003826f, 0x142929670a0e6e70, 0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed,
+    0x53380d139d95b3df, 0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b,
+    0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30, 0xd192e819d6ef5218,
+    0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8, 0x19a4c116b8d2d0c8, 0x1e376c085141ab53,
+    0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8, 0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373,
+    0x682e6ff3d6b2b8a3, 0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+    0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b, 0xca273eceea26619c,
+    0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178, 0x06f067aa72176fba, 0x0a637dc5a2c898a6,
+    0x113f9804bef90dae, 0x1b710b35131c471b, 0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc,
+    0x431d67c49c100d4c, 0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817,
+};
+
+// The portable compression functions, straight from FIPS 180-4.
+struct SHA256Traits {
+    using Word = uint32_t;
+    static constexpr size_t rounds = 64;
+    static constexpr auto& roundConstants = sha256RoundConstants;
+    static Word bigSigma0(Word x) { return rotateRight(x, 2) ^ rotateRight(x, 13) ^ rotateRight(x, 22); }
+    static Word bigSigma1(Word x) { return rotateRight(x, 6) ^ rotateRight(x, 11) ^ rotateRight(x, 25); }
+    static Word smallSigma0(Word x) { return rotateRight(x, 7) ^ rotateRight(x, 18) ^ (x >> 3); }
+    static Word smallSigma1(Word x) { return rotateRight(x, 17) ^ rotateRight(x, 19) ^ (x >> 10); }
+};
+
+struct SHA512Traits {
+    using Word = uint64_t;
+    static constexpr size_t rounds = 80;
+    static constexpr auto& roundConstants = sha512RoundConstants;
+    static Word bigSigma0(Word x) { return rotateRight(x, 28) ^ rotateRight(x, 34) ^ rotateRight(x, 39); }
+    static Word bigSigma1(Word x) { return rotateRight(x, 14) ^ rotateRight(x, 18) ^ rotateRight(x, 41); }
+    static Word smallSigma0(Word x) { return rotateRight(x, 1) ^ rotateRight(x, 8) ^ (x >> 7); }
+    static Word smallSigma1(Word x) { return rotateRight(x, 19) ^ rotateRight(x, 61) ^ (x >> 6); }
+};
 
-    static jmethodID midGetInstance = env->GetStaticMethodID(
-        GetMessageDigestClass(env),
-        "getInstance",
-        "(Ljava/lang/String;)Lcom/sun/webkit/security/WCMessageDigest;");
-    ASSERT(midGetInstance);
-    JLObject jDigest = env->CallStaticObjectMethod(GetMessageDigestClass(env), midGetInstance, algorithm);
-    if (WTF::CheckAndClearException(env)) {
-        return { };
+template<typename Traits>
+static void processBlocksPortable(std::array<typename Traits::Word, 8>& state, std::span<const uint8_t> blocks)
+{
+    using Word = typename Traits::Word;
+    constexpr size_t blockSize = 16 * sizeof(Word);
+
+    std::array<Word, Traits::rounds> w;
+    for (; blocks.size() >= blockSize; skip(blocks, blockSize)) {
+        for (size_t t = 0; t < 16; ++t)
+            w[t] = loadBigEndian<Word>(blocks.subspan(t * sizeof(Word)));
+        for (size_t t = 16; t < Traits::rounds; ++t)
+            w[t] = Traits::smallSigma1(w[t - 2]) + w[t - 7] + Traits::smallSigma0(w[t - 15]) + w[t - 16];
+
+        Word a = state[0], b = state[1], c = state[2], d = state[3];
+        Word e = state[4], f = state[5], g = state[6], h = state[7];
+        for (size_t t = 0; t < Traits::rounds; ++t) {
+            Word t1 = h + Traits::bigSigma1(e) + ((e & f) ^ (~e & g)) + Traits::roundConstants[t] + w[t];
+            Word t2 = Traits::bigSigma0(a) + ((a & b) ^ (a & c) ^ (b & c));
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
     }
-    return jDigest;
 }
 
-jstring toJavaMessageDigestAlgorithm(CryptoDigest::Algorithm algorithm)
+#if HAVE(SHA_NI_INTRINSICS)
+static bool cpuSupportsSHAExtensions()
 {
-    JNIEnv* env = WTF::GetJavaEnv();
+    static const bool supported = [] {
+        unsigned eax, ebx, ecx, edx;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_SSE4_1))
+            return false;
+        if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+            return false;
+        return !!(ebx & bit_SHA);
+    }();
+    return supported;
+}
 
-    const char* algorithmStr = "";
-    switch (algorithm) {
-        case CryptoDigest::Algorithm::SHA_1:
-            algorithmStr = "SHA-1";
-            break;
-        case CryptoDigest::Algorithm::DEPRECATED_SHA_224:
-            algorithmStr = "SHA-224";
-            break;
-        case CryptoDigest::Algorithm::SHA_256:
-            algorithmStr = "SHA-256";
-            break;
-        case CryptoDigest::Algorithm::SHA_384:
-            algorithmStr = "SHA-384";
-            break;
-        case CryptoDigest::Algorithm::SHA_512:
-            algorithmStr = "SHA-512";
-            break;
+// SHA-256 with the Intel SHA extensions. The state is kept in the ABEF/CDGH
+// layout the sha256rnds2 instruction expects and message words are scheduled
+// four at a time with sha256msg1/sha256msg2.
+__attribute__((target("sha,sse4.1")))
+static void processBlocksSHANI(std::array<uint32_t, 8>& state, std::span<const uint8_t> blocks)
+{
+    const __m128i byteSwapMask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0]));
+    __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4]));
+    tmp = _mm_shuffle_epi32(tmp, 0xB1); // CDAB
+    state1 = _mm_shuffle_epi32(state1, 0x1B); // EFGH
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8); // ABEF
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0); // CDGH
+
+    for (; blocks.size() >= 64; skip(blocks, 64)) {
+        __m128i savedState0 = state0;
+        __m128i savedState1 = state1;
+
+        __m128i messages[4];
+        for (unsigned group = 0; group < 16; ++group) {
+            __m128i& message = messages[group % 4];
+            if (group < 4)
+                message = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks.subspan(group * 16).data())), byteSwapMask);
+            else {
+                // W[t..t+3] from W[t-16..t-13], W[t-12..t-9], W[t-7..t-4] and W[t-4..t-1].
+                const __m128i& previous = messages[(group + 3) % 4];
+                __m128i schedule = _mm_sha256msg1_epu32(message, messages[(group + 1) % 4]);
+                schedule = _mm_add_epi32(schedule, _mm_alignr_epi8(previous, messages[(group + 2) % 4], 4));
+                message = _mm_sha256msg2_epu32(schedule, previous);
+            }
+
+            __m128i roundInput = _mm_add_epi32(message, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&sha256RoundConstants[group * 4])));
+            state1 = _mm_sha256rnds2_epu32(state1, state0, roundInput);
+            roundInput = _mm_shuffle_epi32(roundInput, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, roundInput);
+        }
+
+        state0 = _mm_add_epi32(state0, savedState0);
+        state1 = _mm_add_epi32(state1, savedState1);
     }
-    return env->NewStringUTF(algorithmStr);
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B); // FEBA
+    state1 = _mm_shuffle_epi32(state1, 0xB1); // DCHG
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0); // DCBA
+    state1 = _mm_alignr_epi8(state1, tmp, 8); // HGFE
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
 }
+#endif
+
+template<typename Traits>
+class SHA2 {
+public:
+    using Word = typename Traits::Word;
+    static constexpr size_t blockSize = 16 * sizeof(Word);
+
+    SHA2(const std::array<Word, 8>& initialState, size_t hashSize)
+        : m_state(initialState)
+        , m_hashSize(hashSize)
+    {
+    }
+
+    void addBytes(std::span<const uint8_t> input)
+    {
+        m_totalBytes += input.size();
+
+        if (m_cursor) {
+            size_t count = std::min(input.size(), blockSize - m_cursor);
+            memcpySpan(std::span { m_buffer }.subspan(m_cursor, count), input.first(count));
+            skip(input, count);
+            m_cursor += count;
+            if (m_cursor < blockSize)
+                return;
+            processBlocks(std::span { m_buffer });
+            m_cursor = 0;
+        }
+
+        size_t wholeBlocks = input.size() - input.size() % blockSize;
+        processBlocks(input.first(wholeBlocks));
+        skip(input, wholeBlocks);
+
+        memcpySpan(std::span { m_buffer }, input);
+        m_cursor = input.size();
+    }
+
+    Vector<uint8_t> computeHash()
+    {
+        // Pad with 0x80, zeroes and the message length in bits, stored
+        // big-endian in the last two words of the final block.
+        uint64_t totalBits = m_totalBytes * 8;
+        std::array<uint8_t, 2 * blockSize> padding { };
+        padding[0] = 0x80;
+        size_t paddingLength = (m_cursor < blockSize - 2 * sizeof(Word) ? blockSize : 2 * blockSize) - m_cursor;
+        storeBigEndian<uint64_t>(totalBits, std::span { padding }.subspan(paddingLength - sizeof(uint64_t), sizeof(uint64_t)));
+        addBytes(std::span { padding }.first(paddingLength));
+        ASSERT(!m_cursor);
+
+        Vector<uint8_t> hash(m_hashSize);
+        std::array<uint8_t, 8 * sizeof(Word)> digest;
+        for (size_t i = 0; i < 8; ++i)
+            storeBigEndian<Word>(m_state[i], std::span { digest }.subspan(i * sizeof(Word)));
+        memcpySpan(hash.mutableSpan(), std::span { digest }.first(m_hashSize));
+        return hash;
+    }
+
+private:
+    void processBlocks(std::span<const uint8_t> blocks)
+    {
+        if (blocks.empty())
+            return;
+#if HAVE(SHA_NI_INTRINSICS)
+        if constexpr (std::is_same_v<Traits, SHA256Traits>) {
+            if (cpuSupportsSHAExtensions()) {
+                processBlocksSHANI(m_state, blocks);
+                return;
+            }
+        }
+#endif
+        processBlocksPortable<Traits>(m_state, blocks);
+    }
+
+    std::array<Word, 8> m_state;
+    std::array<uint8_t, blockSize> m_buffer;
+    size_t m_cursor { 0 };
+    uint64_t m_totalBytes { 0 };
+    size_t m_hashSize;
+};
+
+using SHA256 = SHA2<SHA256Traits>;
+using SHA512 = SHA2<SHA512Traits>;
 
 } // namespace CryptoDigestInternal
 
 struct CryptoDigestContext {
-    JGObject jDigest { };
+    std::variant<std::monostate, SHA1, CryptoDigestInternal::SHA256, CryptoDigestInternal::SHA512> digest;
 };
 
 CryptoDigest::CryptoDigest()
@@ -105,53 +320,54 @@ std::unique_ptr<CryptoDigest> CryptoDigest::create(CryptoDigest::Algorithm algor
 {
     using namespace CryptoDigestInternal;
     auto digest = std::unique_ptr<CryptoDigest>(new CryptoDigest);
-    digest->m_context->jDigest = GetMessageDigestInstance(toJavaMessageDigestAlgorithm(algorithm));
+    auto& context = digest->m_context->digest;
+    switch (algorithm) {
+    case CryptoDigest::Algorithm::SHA_1:
+        context.emplace<SHA1>();
+        break;
+    case CryptoDigest::Algorithm::DEPRECATED_SHA_224:
+        context.emplace<SHA256>(std::array<uint32_t, 8> {
+            0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939, 0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4 }, 28);
+        break;
+    case CryptoDigest::Algorithm::SHA_256:
+        context.emplace<SHA256>(std::array<uint32_t, 8> {
+            0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 }, 32);
+        break;
+    case CryptoDigest::Algorithm::SHA_384:
+        context.emplace<SHA512>(std::array<uint64_t, 8> {
+            0xcbbb9d5dc1059ed8, 0x629a292a367cd507, 0x9159015a3070dd17, 0x152fecd8f70e5939,
+            0x67332667ffc00b31, 0x8eb44a8768581511, 0xdb0c2e0d64f98fa7, 0x47b5481dbefa4fa4 }, 48);
+        break;
+    case CryptoDigest::Algorithm::SHA_512:
+        context.emplace<SHA512>(std::array<uint64_t, 8> {
+            0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+            0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179 }, 64);
+        break;
+    }
     return digest;
 }
 
 void CryptoDigest::addBytes(std::span<const uint8_t> input)
 {
-    using namespace CryptoDigestInternal;
-
-    JNIEnv* env = WTF::GetJavaEnv();
-    if (!m_context->jDigest || !env) {
-        return;
-    }
-
-    static jmethodID midUpdate = env->GetMethodID(
-        GetMessageDigestClass(env),
-        "addBytes",
-        "(Ljava/nio/ByteBuffer;)V");
-    ASSERT(midUpdate);
-    env->CallVoidMethod(jobject(m_context->jDigest), midUpdate, env->NewDirectByteBuffer(const_cast<void*>(reinterpret_cast<const void*>(input.data())), input.size()));
+    WTF::switchOn(m_context->digest,
+        [](std::monostate) { },
+        [&](auto& digest) { digest.addBytes(input); });
 }
 
 Vector<uint8_t> CryptoDigest::computeHash()
 {
-    using namespace CryptoDigestInternal;
-
-    JNIEnv* env = WTF::GetJavaEnv();
-    if (!m_context->jDigest || !env) {
-        return { };
-    }
-
-    static jmethodID midDigest = env->GetMethodID(
-        GetMessageDigestClass(env),
-        "computeHash",
-        "()[B");
-    ASSERT(midDigest);
-
-    JLocalRef<jbyteArray> jDigestBytes = static_cast<jbyteArray>(env->CallObjectMethod(jobject(m_context->jDigest), midDigest));
-    void* digest = env->GetPrimitiveArrayCritical(static_cast<jbyteArray>(jDigestBytes), 0);
-    if (!digest) {
-        return { };
-    }
-
-    Vector<uint8_t> result;
-    std::span<const uint8_t> createSpan(reinterpret_cast<const uint8_t*>(digest), env->GetArrayLength(jDigestBytes));
-    result.append(createSpan);
-    env->ReleasePrimitiveArrayCritical(jDigestBytes, digest, 0);
-    return result;
+    return WTF::switchOn(m_context->digest,
+        [](std::monostate) -> Vector<uint8_t> {
+            return { };
+        },
+        [](SHA1& digest) -> Vector<uint8_t> {
+            SHA1::Digest hash;
+            digest.computeHash(hash);
+            return Vector<uint8_t>(std::span { hash });
+        },
+        [](auto& digest) -> Vector<uint8_t> {
+            return digest.computeHash();
+        });
 }
 
 } // namespace PAL
@@ -1,5 +1,13 @@
 include(platform/TextureMapper.cmake)
 
+if (USE_JAVA_NATIVE_IMAGE_DECODERS)
+    include(platform/ImageDecoders.cmake)
+
+    list(APPEND WebCore_SOURCES
+        platform/image-decoders/java/ImageBackingStoreJava.cpp
+    )
+endif ()
+
 set(WebCore_OUTPUT_NAME WebCore)
 
 # JDK-9 +
@@ -102,6 +110,7 @@ list(APPEND WebCore_PRIVATE_FRAMEWORK_HEADERS
     platform/graphics/texmap/BitmapTextureJava.h
     platform/graphics/texmap/TextureMapperJava.h
     platform/graphics/texmap/TextureMapperJavaAdapter.h
+    platform/java/BytecodeCacheJava.h
     platform/java/DataObjectJava.h
     platform/java/PageSupplementJava.h
     platform/java/PlatformJavaClasses.h
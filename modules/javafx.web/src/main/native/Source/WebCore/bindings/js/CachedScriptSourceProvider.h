@@ -31,6 +31,10 @@
 #include "CachedScriptFetcher.h"
 #include <JavaScriptCore/SourceProvider.h>
 
+#if PLATFORM(JAVA)
+#include "BytecodeCacheJava.h"
+#endif
+
 namespace WebCore {
 
 class CachedScriptSourceProvider final : public JSC::SourceProvider, public CachedResourceClient {
@@ -40,6 +44,9 @@ public:
 
     virtual ~CachedScriptSourceProvider()
     {
+#if PLATFORM(JAVA)
+        commitCachedBytecode();
+#endif
         m_cachedScript->removeClient(*this);
     }
 
@@ -51,6 +58,44 @@ public:
         return m_cachedScript->codeBlockHashConcurrently(startOffset, endOffset, kind, sourceType() == JSC::SourceProviderSourceType::Module ? CachedScript::ShouldDecodeAsUTF8Only::Yes : CachedScript::ShouldDecodeAsUTF8Only::No);
     }
 
+#if PLATFORM(JAVA)
+    RefPtr<JSC::CachedBytecode> cachedBytecode() const final
+    {
+        if (!m_didLoadCachedBytecode) {
+            m_didLoadCachedBytecode = true;
+            m_cachedBytecode = BytecodeCacheJava::load(*this);
+        }
+        return m_cachedBytecode.copyRef();
+    }
+
+    void cacheBytecode(const JSC::BytecodeCacheGenerator& generator) const final
+    {
+        if (!BytecodeCacheJava::isEnabled())
+            return;
+        if (!m_cachedBytecode)
+            m_cachedBytecode = JSC::CachedBytecode::create();
+        if (auto update = generator()) {
+            m_cachedBytecode->addGlobalUpdate(update.releaseNonNull());
+            // Write the program bytecode right away, as the provider may
+            // live as long as the application does. Function updates made
+            // on top of a cached file are written when it goes away.
+            commitCachedBytecode();
+        }
+    }
+
+    void updateCache(const JSC::UnlinkedFunctionExecutable* executable, const JSC::SourceCode&, JSC::CodeSpecializationKind kind, const JSC::UnlinkedFunctionCodeBlock* codeBlock) const final
+    {
+        if (m_cachedBytecode)
+            BytecodeCacheJava::addFunctionUpdate(*m_cachedBytecode, executable, kind, codeBlock);
+    }
+
+    void commitCachedBytecode() const final
+    {
+        if (auto cachedBytecode = std::exchange(m_cachedBytecode, nullptr))
+            BytecodeCacheJava::commit(*this, *cachedBytecode);
+    }
+#endif
+
 private:
     CachedScriptSourceProvider(CachedScript* cachedScript, JSC::SourceProviderSourceType sourceType, Ref<CachedScriptFetcher>&& scriptFetcher)
         : SourceProvider(JSC::SourceOrigin { cachedScript->response().url(), WTFMove(scriptFetcher) }, String(cachedScript->response().url().string()), cachedScript->response().isRedirected() ? String(cachedScript->url().string()) : String(), cachedScript->requiresPrivacyProtections() ? JSC::SourceTaintedOrigin::KnownTainted : JSC::SourceTaintedOrigin::Untainted, TextPosition(), sourceType)
@@ -60,6 +105,10 @@ private:
     }
 
     CachedResourceHandle<CachedScript> m_cachedScript;
+#if PLATFORM(JAVA)
+    mutable RefPtr<JSC::CachedBytecode> m_cachedBytecode;
+    mutable bool m_didLoadCachedBytecode { false };
+#endif
 };
 
 inline unsigned CachedScriptSourceProvider::hash() const
@@ -56,7 +56,12 @@ DEFINE_ALLOCATOR_WITH_HEAP_IDENTIFIER(HTMLDocumentParser);
 
 static bool isMainDocumentLoadingFromHTTP(const Document& document)
 {
+#if PLATFORM(JAVA)
+    // The trace points feed WTF::PerfCounters, which also times local pages.
+    return !document.ownerElement();
+#else
     return !document.ownerElement() && document.url().protocolIsInHTTPFamily();
+#endif
 }
 
 HTMLDocumentParser::HTMLDocumentParser(HTMLDocument& document, OptionSet<ParserContentPolicy> policy)
@@ -252,13 +252,17 @@ SubsamplingLevel BitmapImageDescriptor::maximumSubsamplingLevel() const
 
 SubsamplingLevel BitmapImageDescriptor::subsamplingLevelForScaleFactor(GraphicsContext& context, const FloatSize& scaleFactor, AllowImageSubsampling allowImageSubsampling) const
 {
-#if USE(CG)
+#if USE(CG) || PLATFORM(JAVA)
     if (allowImageSubsampling == AllowImageSubsampling::No)
         return SubsamplingLevel::Default;
 
+#if USE(CG)
     // Never use subsampled images for drawing into PDF contexts.
     if (context.hasPlatformContext() && CGContextGetType(context.platformContext()) == kCGContextTypePDF)
         return SubsamplingLevel::Default;
+#else
+    UNUSED_PARAM(context);
+#endif
 
     float scale = std::min(float(1), std::max(scaleFactor.width(), scaleFactor.height()));
     if (!(scale > 0 && scale <= 1))
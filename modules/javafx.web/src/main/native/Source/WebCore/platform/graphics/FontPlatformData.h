@@ -58,6 +58,7 @@ WTF_IGNORE_WARNINGS_IN_THIRD_PARTY_CODE_END
 #endif
 
 #if PLATFORM(JAVA)
+#include "GlyphMetricsJava.h"
 #include "PlatformJavaClasses.h"
 #include "RQRef.h"
 #endif
@@ -394,6 +395,7 @@ public:
 
 #if PLATFORM(JAVA)
     RefPtr<RQRef> nativeFontData() const { return m_jFont; }
+    GlyphMetricsJava* glyphMetrics() const { return m_glyphMetrics.get(); }
 #endif
 
     unsigned hash() const;
@@ -488,6 +490,9 @@ private:
 
 #if PLATFORM(JAVA)
     RefPtr<RQRef> m_jFont;
+    // Created for every instance, including the empty and deleted ones,
+    // and shared by its copies.
+    RefPtr<GlyphMetricsJava> m_glyphMetrics { GlyphMetricsJava::create() };
 #endif
 
     float m_size { 0 };
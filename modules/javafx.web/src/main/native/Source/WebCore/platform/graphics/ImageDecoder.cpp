@@ -27,7 +27,7 @@
 #include "ImageDecoder.h"
 
 #include "ImageFrame.h"
-#if !PLATFORM(JAVA)
+#if !PLATFORM(JAVA) || USE(JAVA_NATIVE_IMAGE_DECODERS)
 #include "ScalableImageDecoder.h"
 #endif
 #include <wtf/NeverDestroyed.h>
@@ -122,6 +122,11 @@ RefPtr<ImageDecoder> ImageDecoder::create(FragmentedSharedBuffer& data, const St
         return imageDecoder;
     return ImageDecoderCG::create(data, alphaOption, gammaAndColorProfileOption);
 #elif PLATFORM(JAVA)
+#if USE(JAVA_NATIVE_IMAGE_DECODERS)
+    // Formats WebCore has a decoder for are decoded in-process; anything else is left to the Java image loaders.
+    if (auto imageDecoder = ScalableImageDecoder::create(data, alphaOption, gammaAndColorProfileOption))
+        return imageDecoder;
+#endif
     return ImageDecoderJava::create(data, alphaOption, gammaAndColorProfileOption);
 #else
     return ScalableImageDecoder::create(data, alphaOption, gammaAndColorProfileOption);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -135,6 +135,7 @@ FloatRect jGetGlyphPosAndAdvance(jobject jRun, unsigned glyphIndex)
         "(I)[F");
     ASSERT(mID);
 
+    LOG_PERF_RECORD("WCTextRun", "getGlyphPosAndAdvance");
     JLocalRef<jfloatArray> jpos = static_cast<jfloatArray> (env->CallObjectMethod(
                                                               jRun, mID, glyphIndex));
     WTF::CheckAndClearException(env);
@@ -224,6 +225,7 @@ void ComplexTextController::collectComplexTextRunsForCharacters(std::span<const
         "(Ljava/lang/String;)[Lcom/sun/webkit/graphics/WCTextRun;");
     ASSERT(getTextRuns_mID);
 
+    LOG_PERF_RECORD("WCFont", "getTextRuns");
     JLocalRef<jobjectArray> jRuns = static_cast<jobjectArray> (env->CallObjectMethod(
                                                                   *jFont,
                                                                   getTextRuns_mID,
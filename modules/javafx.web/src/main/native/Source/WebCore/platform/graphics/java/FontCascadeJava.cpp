@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,62 +40,34 @@ namespace WebCore {
 void FontCascade::drawGlyphs(GraphicsContext& context, const Font& font, std::span<const GlyphBufferGlyph> glyphs, std::span<const GlyphBufferAdvance> advances,
 const FloatPoint& point, FontSmoothingMode)
 {
-    const unsigned numGlyphs = glyphs.size();
-    // we need to call freeSpace() before refIntArr() and refFloatArr(), see JDK-8127455.
-    RenderingQueue& rq = context.platformContext()->rq().freeSpace(24);
+    RenderingQueue& rq = context.platformContext()->rq();
+    RefPtr<RQRef> jFont = font.platformData().nativeFontData();
 
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    //prepare Glyphs array
-    JLocalRef<jintArray> jGlyphs(env->NewIntArray(numGlyphs));
-    ASSERT(jGlyphs);
-    {
-        jint *bufArray = (jint*)env->GetPrimitiveArrayCritical(jGlyphs, NULL);
-        ASSERT(bufArray);
-        for (unsigned i = 0; i < numGlyphs; ++i)
-            bufArray[i] = static_cast<jint>(glyphs[i]); // glyphs[i] is a GlyphBufferGlyph
-        env->ReleasePrimitiveArrayCritical(jGlyphs, bufArray, 0);
+    // Glyph ids and advances are written inline into the queue, so a run
+    // costs no JNI calls. Runs that do not fit into a single buffer are
+    // split into several commands, each starting where the previous one ended.
+    static const int headerSize = 5 * sizeof(jint);
+    const size_t maxGlyphsPerCommand = (rq.capacity() - headerSize) / (sizeof(jint) + sizeof(jfloat));
+    float x = point.x();
+    size_t from = 0;
+    while (from < glyphs.size()) {
+        const size_t count = std::min(glyphs.size() - from, maxGlyphsPerCommand);
+        rq.freeSpace(headerSize + static_cast<int>(count * (sizeof(jint) + sizeof(jfloat))));
+        rq << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWSTRING_INLINE
+           << jFont
+           << static_cast<jfloat>(x)
+           << static_cast<jfloat>(point.y())
+           << static_cast<jint>(count);
+        for (size_t i = from; i < from + count; ++i) {
+            rq << static_cast<jint>(glyphs[i]); // glyphs[i] is a GlyphBufferGlyph
+        }
+        for (size_t i = from; i < from + count; ++i) {
+            float advance = advances[i].width();
+            rq << static_cast<jfloat>(advance);
+            x += advance;
+        }
+        from += count;
     }
-    static jmethodID refIntArr_mID = env->GetMethodID(
-        PG_GetRenderQueueClass(env),
-        "refIntArr",
-        "([I)I");
-    ASSERT(refIntArr_mID);
-    jint sid = env->CallIntMethod(
-        rq.getWCRenderingQueue(),
-        refIntArr_mID,
-        (jintArray)jGlyphs);
-    WTF::CheckAndClearException(env);
-
-
-    // Prepare Offsets/Advances array
-    JLocalRef<jfloatArray> jAdvance(env->NewFloatArray(numGlyphs));
-    WTF::CheckAndClearException(env);
-    ASSERT(jAdvance);
-    {
-        jfloat *bufArray = env->GetFloatArrayElements(jAdvance, NULL);
-        ASSERT(bufArray);
-        for (unsigned i = 0; i < numGlyphs; ++i)
-            bufArray[i] = static_cast<jfloat>(advances[i].width());
-        env->ReleaseFloatArrayElements(jAdvance, bufArray, 0);
-    }
-    static jmethodID refFloatArr_mID = env->GetMethodID(
-        PG_GetRenderQueueClass(env),
-        "refFloatArr",
-        "([F)I");
-    ASSERT(refFloatArr_mID);
-    jint aid = env->CallIntMethod(
-        rq.getWCRenderingQueue(),
-        refFloatArr_mID,
-        (jfloatArray)jAdvance);
-    WTF::CheckAndClearException(env);
-
-    rq << (jint)com_sun_webkit_graphics_GraphicsDecoder_DRAWSTRING_FAST
-       << font.platformData().nativeFontData()
-       << sid
-       << aid
-       << static_cast<jfloat>(point.x())
-       << static_cast<jfloat>(point.y());
 }
 
 bool FontCascade::canReturnFallbackFontsForComplexText()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,6 +47,7 @@ RefPtr<RQRef> getJavaFont(const String& family, float size, bool italic, bool bo
         "getWCFont", "(Ljava/lang/String;ZZF)Lcom/sun/webkit/graphics/WCFont;");
     ASSERT(mid);
 
+    LOG_PERF_RECORD("WCGraphicsManager", "getWCFont");
     JLObject wcFont(env->CallObjectMethod( PL_GetGraphicsManager(env), mid,
         (jstring)JLString(family.toJavaString(env)),
         bool_to_jbool(bold),
@@ -108,6 +109,7 @@ bool FontPlatformData::platformIsEqual(const FontPlatformData& other) const
         PG_GetFontClass(env), "equals", "(Ljava/lang/Object;)Z");
     ASSERT(compare_mID);
 
+    LOG_PERF_RECORD("WCFont", "equals");
     jboolean res = env->CallBooleanMethod(*m_jFont, compare_mID, (jobject)(*other.m_jFont));
     WTF::CheckAndClearException(env);
 
@@ -125,6 +127,7 @@ unsigned FontPlatformData::hash() const
     static jmethodID hash_mID = env->GetMethodID(PG_GetFontClass(env), "hashCode", "()I");
     ASSERT(hash_mID);
 
+    LOG_PERF_RECORD("WCFont", "hashCode");
     jint res = env->CallIntMethod(*m_jFont, hash_mID);
     WTF::CheckAndClearException(env);
 
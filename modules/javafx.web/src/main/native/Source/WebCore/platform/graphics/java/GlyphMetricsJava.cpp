@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "GlyphMetricsJava.h"
+
+#include "PlatformJavaClasses.h"
+
+namespace WebCore {
+
+float GlyphMetricsJava::widthForGlyph(jobject jFont, Glyph glyph)
+{
+    if (glyph < 0) {
+        return 0.0f;
+    }
+    unsigned pageNumber = static_cast<unsigned>(glyph) / PAGE_SIZE;
+    auto it = m_widthPages.find(pageNumber + 1);
+    if (it != m_widthPages.end()) {
+        return (*it->value)[glyph % PAGE_SIZE];
+    }
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID getGlyphWidths_mID = env->GetMethodID(PG_GetFontClass(env),
+        "getGlyphWidths", "(I[F)V");
+    ASSERT(getGlyphWidths_mID);
+
+    JLocalRef<jfloatArray> jWidths(env->NewFloatArray(PAGE_SIZE));
+    if (!jWidths) {
+        WTF::CheckAndClearException(env);
+        return 0.0f;
+    }
+    LOG_PERF_RECORD("WCFont", "getGlyphWidths");
+    env->CallVoidMethod(jFont, getGlyphWidths_mID, static_cast<jint>(pageNumber * PAGE_SIZE), (jfloatArray)jWidths);
+    if (WTF::CheckAndClearException(env)) {
+        // Not cached, so the next lookup asks again.
+        return 0.0f;
+    }
+    auto page = makeUnique<WidthPage>();
+    env->GetFloatArrayRegion(jWidths, 0, PAGE_SIZE, page->data());
+    float width = (*page)[glyph % PAGE_SIZE];
+    m_widthPages.add(pageNumber + 1, WTFMove(page));
+    return width;
+}
+
+FloatRect GlyphMetricsJava::boundsForGlyph(jobject jFont, Glyph glyph)
+{
+    if (glyph < 0) {
+        return { };
+    }
+    unsigned blockNumber = static_cast<unsigned>(glyph) / BOUNDS_BLOCK_SIZE;
+    auto it = m_boundsBlocks.find(blockNumber + 1);
+    if (it != m_boundsBlocks.end()) {
+        return (*it->value)[glyph % BOUNDS_BLOCK_SIZE];
+    }
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID getGlyphBoundingBoxes_mID = env->GetMethodID(PG_GetFontClass(env),
+        "getGlyphBoundingBoxes", "(I[F)V");
+    ASSERT(getGlyphBoundingBoxes_mID);
+
+    JLocalRef<jfloatArray> jBoxes(env->NewFloatArray(4 * BOUNDS_BLOCK_SIZE));
+    if (!jBoxes) {
+        WTF::CheckAndClearException(env);
+        return { };
+    }
+    LOG_PERF_RECORD("WCFont", "getGlyphBoundingBoxes");
+    env->CallVoidMethod(jFont, getGlyphBoundingBoxes_mID, static_cast<jint>(blockNumber * BOUNDS_BLOCK_SIZE), (jfloatArray)jBoxes);
+    if (WTF::CheckAndClearException(env)) {
+        // Not cached, so the next lookup asks again.
+        return { };
+    }
+    jfloat* boxes = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(jBoxes, nullptr));
+    if (!boxes) {
+        WTF::CheckAndClearException(env);
+        return { };
+    }
+    auto block = makeUnique<BoundsBlock>();
+    for (unsigned i = 0; i < BOUNDS_BLOCK_SIZE; ++i) {
+        (*block)[i] = FloatRect { boxes[4 * i], boxes[4 * i + 1], boxes[4 * i + 2], boxes[4 * i + 3] };
+    }
+    env->ReleasePrimitiveArrayCritical(jBoxes, boxes, JNI_ABORT);
+    FloatRect bounds = (*block)[glyph % BOUNDS_BLOCK_SIZE];
+    m_boundsBlocks.add(blockNumber + 1, WTFMove(block));
+    return bounds;
+}
+
+} // namespace WebCore
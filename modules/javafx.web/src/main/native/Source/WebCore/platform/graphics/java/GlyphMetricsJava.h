@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include "FloatRect.h"
+#include "Glyph.h"
+#include <array>
+#include <jni.h>
+#include <wtf/HashMap.h>
+#include <wtf/RefCounted.h>
+#include <wtf/Ref.h>
+
+namespace WebCore {
+
+/*
+ * Native copy of the glyph advances and bounding boxes of a WCFont.
+ * Advances are fetched from java a whole page (PAGE_SIZE glyphs) at a time,
+ * so laying out a document costs one up-call per page instead of one per
+ * glyph. Bounds are only asked for the few glyphs whose ink overflows, so
+ * they are fetched in much smaller blocks. An instance is shared by all
+ * copies of a FontPlatformData.
+ */
+class GlyphMetricsJava : public RefCounted<GlyphMetricsJava> {
+public:
+    static const unsigned PAGE_SIZE = 256;
+    static const unsigned BOUNDS_BLOCK_SIZE = 16;
+
+    static Ref<GlyphMetricsJava> create() {
+        return adoptRef(*new GlyphMetricsJava());
+    }
+
+    float widthForGlyph(jobject jFont, Glyph);
+    FloatRect boundsForGlyph(jobject jFont, Glyph);
+
+private:
+    GlyphMetricsJava() = default;
+
+    using WidthPage = std::array<float, PAGE_SIZE>;
+    using BoundsBlock = std::array<FloatRect, BOUNDS_BLOCK_SIZE>;
+
+    // Keys are page and block numbers plus one, as zero is the empty value
+    // of the map.
+    HashMap<unsigned, std::unique_ptr<WidthPage>> m_widthPages;
+    HashMap<unsigned, std::unique_ptr<BoundsBlock>> m_boundsBlocks;
+};
+
+} // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -93,6 +93,11 @@ static void setGradient(Gradient &gradient,
     p0 = gradientSpaceTransformation.mapPoint(p0);
     p1 = gradientSpaceTransformation.mapPoint(p1);
 
+    // The gradient replaces the color of the java graphics context.
+    context->rq().invalidateState(id == com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT
+        ? RenderingQueue::StateSlot::FillColor
+        : RenderingQueue::StateSlot::StrokeColor);
+
     context->rq().freeSpace(4 * 11 + 20 * nStops)
     << id
     << (jfloat)p0.x()
@@ -161,8 +166,7 @@ void GraphicsContextJava::savePlatformState()
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(4)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SAVESTATE;
+    platformContext()->rq().saveState();
 }
 
 void GraphicsContextJava::restore(GraphicsContextState::Purpose) {
@@ -175,8 +179,7 @@ void GraphicsContextJava::restorePlatformState()
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(4)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_RESTORESTATE;
+    platformContext()->rq().restoreState();
 }
 
 // Draws a filled rectangle with a stroked border.
@@ -231,11 +234,7 @@ void GraphicsContextJava::fillRect(const FloatRect& rect, const Color& color)
         return;
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(36)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFFI
-    << rect.x() << rect.y()
-    << rect.width() << rect.height()
-    << r << g << b << a;
+    platformContext()->rq().fillRect(rect.x(), rect.y(), rect.width(), rect.height(), r, g, b, a);
 }
 
 void GraphicsContextJava::fillRect(const FloatRect& rect, RequiresClipToRect requiresClip)
@@ -261,10 +260,7 @@ void GraphicsContextJava::fillRect(const FloatRect& rect, RequiresClipToRect req
                 com_sun_webkit_graphics_GraphicsDecoder_SET_FILL_GRADIENT);
         }
 
-        platformContext()->rq().freeSpace(20)
-        << (jint)com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFF
-        << rect.x() << rect.y()
-        << rect.width() << rect.height();
+        platformContext()->rq().fillRect(rect.x(), rect.y(), rect.width(), rect.height());
     }
 }
 
@@ -506,9 +502,8 @@ void GraphicsContextJava::setPlatformFillColor(const Color& color)
         return;
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(20)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR
-    << r << g << b << a;
+    platformContext()->rq().putState(RenderingQueue::StateSlot::FillColor,
+        com_sun_webkit_graphics_GraphicsDecoder_SETFILLCOLOR, r, g, b, a);
 }
 
 void GraphicsContextJava::setPlatformTextDrawingMode(TextDrawingModeFlags mode)
@@ -516,11 +511,11 @@ void GraphicsContextJava::setPlatformTextDrawingMode(TextDrawingModeFlags mode)
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(16)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_TEXT_MODE
-    << (jint)(mode.contains(TextDrawingMode::Fill))
-    << (jint)(mode.contains(TextDrawingMode::Stroke))
-    << (jint)0;
+    platformContext()->rq().putState(RenderingQueue::StateSlot::TextMode,
+        com_sun_webkit_graphics_GraphicsDecoder_SET_TEXT_MODE,
+        (jint)(mode.contains(TextDrawingMode::Fill)),
+        (jint)(mode.contains(TextDrawingMode::Stroke)),
+        (jint)0);
     //utatodo:
     //<< (jint)(mode & TextModeClip);
 }
@@ -530,9 +525,8 @@ void GraphicsContextJava::setPlatformStrokeStyle(StrokeStyle style)
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(8)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKESTYLE
-    << (jint)style;
+    platformContext()->rq().putState(RenderingQueue::StateSlot::StrokeStyle,
+        com_sun_webkit_graphics_GraphicsDecoder_SETSTROKESTYLE, (jint)style);
 }
 
 void GraphicsContextJava::setPlatformStrokeColor(const Color& color)
@@ -541,9 +535,8 @@ void GraphicsContextJava::setPlatformStrokeColor(const Color& color)
         return;
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(20)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR
-    << r << g << b << a;
+    platformContext()->rq().putState(RenderingQueue::StateSlot::StrokeColor,
+        com_sun_webkit_graphics_GraphicsDecoder_SETSTROKECOLOR, r, g, b, a);
 }
 
 void GraphicsContextJava::setPlatformStrokeThickness(float strokeThickness)
@@ -551,9 +544,8 @@ void GraphicsContextJava::setPlatformStrokeThickness(float strokeThickness)
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(8)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSTROKEWIDTH
-    << strokeThickness;
+    platformContext()->rq().putState(RenderingQueue::StateSlot::StrokeThickness,
+        com_sun_webkit_graphics_GraphicsDecoder_SETSTROKEWIDTH, strokeThickness);
 }
 
 void GraphicsContextJava::setPlatformImageInterpolationQuality(InterpolationQuality)
@@ -611,9 +603,9 @@ void GraphicsContextJava::setPlatformShadow(const FloatSize& s, float blur, cons
 #endif
 
     auto [r, g, b, a] = color.toColorTypeLossy<SRGBA<float>>().resolved();
-    platformContext()->rq().freeSpace(32)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSHADOW
-    << width << height << blur << r << g << b << a;;
+    platformContext()->rq().putState(RenderingQueue::StateSlot::Shadow,
+        com_sun_webkit_graphics_GraphicsDecoder_SETSHADOW,
+        width, height, blur, r, g, b, a);
 }
 
 void GraphicsContextJava::beginTransparencyLayer(float opacity)
@@ -623,9 +615,7 @@ void GraphicsContextJava::beginTransparencyLayer(float opacity)
     if (paintingDisabled())
       return;
 
-    platformContext()->rq().freeSpace(8)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_BEGINTRANSPARENCYLAYER
-    << opacity;
+    platformContext()->rq().beginTransparencyLayer(opacity);
 }
 
 void GraphicsContextJava::endTransparencyLayer()
@@ -633,8 +623,7 @@ void GraphicsContextJava::endTransparencyLayer()
     if (paintingDisabled())
       return;
 
-    platformContext()->rq().freeSpace(4)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_ENDTRANSPARENCYLAYER;
+    platformContext()->rq().endTransparencyLayer();
 
     GraphicsContext::endTransparencyLayer();
 }
@@ -694,9 +683,8 @@ void GraphicsContextJava::setLineCap(LineCap cap)
       return;
     }
 
-    platformContext()->rq().freeSpace(8)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_LINE_CAP
-    << (jint)cap;
+    platformContext()->rq().putState(RenderingQueue::StateSlot::LineCap,
+        com_sun_webkit_graphics_GraphicsDecoder_SET_LINE_CAP, (jint)cap);
 
     platformContext()->setLineCap(cap);
 }
@@ -706,9 +694,8 @@ void GraphicsContextJava::setLineJoin(LineJoin join)
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(8)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_LINE_JOIN
-    << (jint)join;
+    platformContext()->rq().putState(RenderingQueue::StateSlot::LineJoin,
+        com_sun_webkit_graphics_GraphicsDecoder_SET_LINE_JOIN, (jint)join);
 
     platformContext()->setLineJoin(join);
 }
@@ -718,18 +705,16 @@ void GraphicsContextJava::setMiterLimit(float limit)
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(8)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_MITER_LIMIT
-    << (jfloat)limit;
+    platformContext()->rq().putState(RenderingQueue::StateSlot::MiterLimit,
+        com_sun_webkit_graphics_GraphicsDecoder_SET_MITER_LIMIT, (jfloat)limit);
 
     platformContext()->setMiterLimit(limit);
 }
 
 void GraphicsContextJava::setPlatformAlpha(float alpha)
 {
-    platformContext()->rq().freeSpace(8)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETALPHA
-    << alpha;
+    platformContext()->rq().putState(RenderingQueue::StateSlot::Alpha,
+        com_sun_webkit_graphics_GraphicsDecoder_SETALPHA, alpha);
 }
 
 void GraphicsContextJava::setPlatformCompositeOperation(CompositeOperator op, BlendMode)
@@ -737,9 +722,8 @@ void GraphicsContextJava::setPlatformCompositeOperation(CompositeOperator op, Bl
     if (paintingDisabled())
         return;
 
-    platformContext()->rq().freeSpace(8)
-    << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETCOMPOSITE
-    << (jint)op;
+    platformContext()->rq().putState(RenderingQueue::StateSlot::Composite,
+        com_sun_webkit_graphics_GraphicsDecoder_SETCOMPOSITE, (jint)op);
     //utatodo: add BlendMode
 }
 
@@ -809,8 +793,15 @@ void GraphicsContextJava::drawPlatformImage(const PlatformImagePtr& image, const
     if (!image || !image->getImage())
         return;
 
-    savePlatformState();
-    setCompositeOperation(options.compositeOperator(), options.blendMode());
+    // Most images are drawn with the composite operation already in effect,
+    // and need no state of their own.
+    bool needsPlatformState = options.orientation() != ImageOrientation::Orientation::None
+        || !platformContext()->rq().hasState(RenderingQueue::StateSlot::Composite,
+            (jint)options.compositeOperator());
+    if (needsPlatformState) {
+        savePlatformState();
+        setCompositeOperation(options.compositeOperator(), options.blendMode());
+    }
 
     FloatRect adjustedSrcRect(srcRect);
     FloatRect adjustedDestRect(destRect);
@@ -834,7 +825,8 @@ void GraphicsContextJava::drawPlatformImage(const PlatformImagePtr& image, const
         << adjustedDestRect.width() << adjustedDestRect.height()
         << adjustedSrcRect.x() << adjustedSrcRect.y()
         << adjustedSrcRect.width() << adjustedSrcRect.height();
-    restorePlatformState();
+    if (needsPlatformState)
+        restorePlatformState();
 }
 
 void GraphicsContextJava::drawPlatformPattern(const PlatformImagePtr& image, const FloatRect& destRect, const FloatRect& tileRect, const AffineTransform& patternTransform, const FloatPoint& phase, const FloatSize&,ImagePaintingOptions)
@@ -1033,9 +1025,9 @@ void GraphicsContextJava::didUpdateState(GraphicsContextState& state)
             setPlatformShadow(dropShadow.offset,dropShadow.radius, dropShadow.color);
         } else {
             float clr = 0.0f;
-            platformContext()->rq().freeSpace(32)
-            << (jint)com_sun_webkit_graphics_GraphicsDecoder_SETSHADOW
-            << clr << clr << clr << clr << clr << clr << clr;
+            platformContext()->rq().putState(RenderingQueue::StateSlot::Shadow,
+                com_sun_webkit_graphics_GraphicsDecoder_SETSHADOW,
+                clr, clr, clr, clr, clr, clr, clr);
         }
     }
 
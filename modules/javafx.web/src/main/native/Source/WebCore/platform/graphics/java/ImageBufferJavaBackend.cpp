@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -142,11 +142,19 @@ Vector<uint8_t> ImageBufferJavaBackend::toDataJava(const String& mimeType, std::
 
 std::pair<void*, size_t> ImageBufferJavaBackend::getDataAndSize()
 {
+    auto& rq = context().platformContext()->rq();
+
+    // Nothing has been drawn since the pixel buffer was last read back, so
+    // it is still current and the round trip to Java can be skipped. The
+    // buffer is owned by the image and is not reallocated.
+    if (m_pixelData && rq.isEmpty() && rq.flushedBufferCount() == m_pixelDataBufferCount)
+        return { m_pixelData, m_pixelDataSize };
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     //RenderQueue need to be processed before pixel buffer extraction.
     //For that purpose it has to be in actual state.
-    context().platformContext()->rq().flushBuffer();
+    rq.flushBuffer();
 
     static jmethodID midGetBGRABytes = env->GetMethodID(
         PG_GetImageClass(env),
@@ -154,6 +162,7 @@ std::pair<void*, size_t> ImageBufferJavaBackend::getDataAndSize()
         "()Ljava/nio/ByteBuffer;");
     ASSERT(midGetBGRABytes);
 
+    LOG_PERF_RECORD("WCImage", "getPixelBuffer");
     jobject pixelBuf = env->CallObjectMethod(getWCImage(), midGetBGRABytes);
     if (WTF::CheckAndClearException(env) || !pixelBuf) {
         return {nullptr, 0};
@@ -164,20 +173,29 @@ std::pair<void*, size_t> ImageBufferJavaBackend::getDataAndSize()
     jlong capacity = env->GetDirectBufferCapacity(byteBuffer);
     if (!data || capacity <= 0)
         return {nullptr, 0};
+
+    m_pixelData = data;
+    m_pixelDataSize = static_cast<size_t>(capacity);
+    m_pixelDataBufferCount = rq.flushedBufferCount();
     return {data, static_cast<size_t>(capacity)};
 }
 
-void ImageBufferJavaBackend::update() const
+void ImageBufferJavaBackend::update(const IntRect& rect) const
 {
+    if (rect.isEmpty())
+        return;
+
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midUpdateByteBuffer = env->GetMethodID(
         PG_GetImageClass(env),
         "drawPixelBuffer",
-        "()V");
+        "(IIII)V");
     ASSERT(midUpdateByteBuffer);
 
-    env->CallObjectMethod(getWCImage(), midUpdateByteBuffer);
+    LOG_PERF_RECORD("WCImage", "drawPixelBuffer");
+    env->CallVoidMethod(getWCImage(), midUpdateByteBuffer,
+        rect.x(), rect.y(), rect.width(), rect.height());
     WTF::CheckAndClearException(env);
 }
 
@@ -219,7 +237,19 @@ void ImageBufferJavaBackend::getPixelBuffer(const IntRect& srcRect, std::span<co
 void ImageBufferJavaBackend::putPixelBuffer(const PixelBufferSourceView& sourcePixelBuffer, const IntRect& srcRect, const IntPoint& destPoint, AlphaPremultiplication destFormat, std::span<uint8_t> destination)
 {
     ImageBufferBackend::putPixelBuffer(sourcePixelBuffer, srcRect, destPoint, destFormat, destination);
-    update();
+}
+
+// The part of the backend that ImageBufferBackend::putPixelBuffer writes to.
+static IntRect putPixelBufferDestinationRect(const PixelBufferSourceView& sourcePixelBuffer, const IntRect& srcRect, const IntPoint& destPoint, const IntSize& backendSize)
+{
+    auto destRect = intersection({ IntPoint::zero(), sourcePixelBuffer.size() }, srcRect);
+    destRect.moveBy(destPoint);
+    if (srcRect.x() < 0)
+        destRect.setX(destRect.x() - srcRect.x());
+    if (srcRect.y() < 0)
+        destRect.setY(destRect.y() - srcRect.y());
+    destRect.intersect({ { }, backendSize });
+    return destRect;
 }
 
 void ImageBufferJavaBackend::putPixelBuffer(const PixelBufferSourceView& sourcePixelBuffer, const IntRect& srcRect, const IntPoint& destPoint, AlphaPremultiplication destFormat) //override
@@ -229,7 +259,8 @@ void ImageBufferJavaBackend::putPixelBuffer(const PixelBufferSourceView& sourceP
         return;
     std::span<uint8_t> spanData(static_cast<uint8_t*>(data), size);
     putPixelBuffer(sourcePixelBuffer, srcRect, destPoint, destFormat, spanData);
-    update();
+    // Only the modified part of the image is uploaded and redrawn.
+    update(putPixelBufferDestinationRect(sourcePixelBuffer, srcRect, destPoint, m_backendSize));
 }
 
 size_t ImageBufferJavaBackend::calculateMemoryCost(const Parameters& parameters)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,7 +47,7 @@ public:
     JLObject getWCImage() const;
     Vector<uint8_t> toDataJava(const String& mimeType, std::optional<double>) override;
     std::pair<void*, size_t> getDataAndSize();
-    void update() const;
+    void update(const IntRect&) const;
 
     GraphicsContext& context() override;
     void flushContext() override;
@@ -77,6 +77,11 @@ protected:
     PlatformImagePtr m_image;
     std::unique_ptr<GraphicsContext> m_context;
     IntSize m_backendSize;
+
+    // The pixel buffer of the image as of the last read back.
+    void* m_pixelData { nullptr };
+    size_t m_pixelDataSize { 0 };
+    unsigned m_pixelDataBufferCount { 0 };
 };
 
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2017, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -117,6 +117,7 @@ void ImageDecoderJava::setData(const FragmentedSharedBuffer& data, bool allDataR
         if (jArray && !WTF::CheckAndClearException(env)) {
             // not OOME in Java
             env->SetByteArrayRegion(jArray, 0, length, (const jbyte*)someData.span().data());
+            LOG_PERF_RECORD("ImageDecoder", "addImageData");
             env->CallVoidMethod(m_nativeDecoder, midAddImageData, (jbyteArray)jArray);
             WTF::CheckAndClearException(env);
         }
@@ -176,9 +177,11 @@ size_t ImageDecoderJava::frameCount() const
         : count;
 }
 
-PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel, const DecodingOptions&)
+PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, SubsamplingLevel subsamplingLevel, const DecodingOptions&)
 {
-    JNIEnv* env = WTF::GetJavaEnv();
+    // DecodingMode::Asynchronous requests arrive on the ImageFrameWorkQueue
+    // thread of the image, which may not be attached to the VM yet.
+    JNIEnv* env = WTF::GetJavaEnvAttachingThread();
     if (!env || !m_nativeDecoder) {
         return { };
     }
@@ -186,13 +189,23 @@ PlatformImagePtr ImageDecoderJava::createFrameImageAtIndex(size_t idx, Subsampli
     static jmethodID midGetFrame = env->GetMethodID(
         PG_GetGraphicsImageDecoderClass(env),
         "getFrame",
-        "(I)Lcom/sun/webkit/graphics/WCImageFrame;");
+        "(III)Lcom/sun/webkit/graphics/WCImageFrame;");
     ASSERT(midGetFrame);
 
+    WTF::PerfCounters::TimerScope decodeScope(WTF::PerfCounters::Timer::ImageDecode);
+
+    // An empty size asks for the frame at its original size.
+    IntSize decodingSize;
+    if (subsamplingLevel != SubsamplingLevel::Default)
+        decodingSize = frameSizeAtIndex(idx, subsamplingLevel);
+
+    LOG_PERF_RECORD("WCImageDecoder", "getFrame");
     JLObject frame(env->CallObjectMethod(
         m_nativeDecoder,
         midGetFrame,
-        idx));
+        idx,
+        decodingSize.width(),
+        decodingSize.height()));
     WTF::CheckAndClearException(env);
 
     if(!frame)
@@ -259,8 +272,18 @@ IntSize ImageDecoderJava::size() const
     return m_size;
 }
 
-IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel) const
+IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel subsamplingLevel) const
 {
+    if (subsamplingLevel != SubsamplingLevel::Default) {
+        // Only single frame images are decoded at a reduced size, each level
+        // halving both dimensions.
+        auto size = frameSizeAtIndex(idx, SubsamplingLevel::Default);
+        if (frameCount() > 1)
+            return size;
+        int scale = 1 << static_cast<int>(subsamplingLevel);
+        return IntSize((size.width() + scale - 1) / scale, (size.height() + scale - 1) / scale);
+    }
+
     JNIEnv* env = WTF::GetJavaEnv();
     if (!env || !m_nativeDecoder) {
         return { };
@@ -287,8 +310,7 @@ IntSize ImageDecoderJava::frameSizeAtIndex(size_t idx, SubsamplingLevel) const
 
 bool ImageDecoderJava::frameAllowSubsamplingAtIndex(size_t) const
 {
-    notImplemented();
-    return true;
+    return frameCount() == 1;
 }
 
 bool ImageDecoderJava::frameHasAlphaAtIndex(size_t) const
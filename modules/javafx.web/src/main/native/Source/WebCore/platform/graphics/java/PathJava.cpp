@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -39,8 +39,11 @@
 #include <wtf/text/WTFString.h>
 #include <wtf/java/JavaRef.h>
 
+#include "com_sun_webkit_graphics_WCPath.h"
 #include "com_sun_webkit_graphics_WCPathIterator.h"
 
+#define SEGMENT(n) com_sun_webkit_graphics_WCPath_SEGMENT_##n
+
 namespace WebCore {
 
 Ref<PathJava> PathJava::create()
@@ -138,9 +141,46 @@ Ref<PathImpl> PathJava::copy() const
 
 PlatformPathPtr PathJava::platformPath() const
 {
+    flushSegments();
     return m_platformPath.get();
 }
 
+void PathJava::appendSegment(jint op, std::initializer_list<jfloat> coords)
+{
+    m_pendingOps.append(op);
+    m_pendingCoords.append(std::span { coords.begin(), coords.size() });
+}
+
+void PathJava::flushSegments() const
+{
+    if (m_pendingOps.isEmpty()) {
+        return;
+    }
+    ASSERT(m_platformPath);
+
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addSegments",
+        "([I[F)V");
+    ASSERT(mid);
+
+    JLocalRef<jintArray> jOps(env->NewIntArray(m_pendingOps.size()));
+    JLocalRef<jfloatArray> jCoords(env->NewFloatArray(m_pendingCoords.size()));
+    if (!jOps || !jCoords) {
+        WTF::CheckAndClearException(env); // OOME
+        return;
+    }
+    env->SetIntArrayRegion(jOps, 0, m_pendingOps.size(), m_pendingOps.data());
+    env->SetFloatArrayRegion(jCoords, 0, m_pendingCoords.size(), m_pendingCoords.data());
+
+    LOG_PERF_RECORD("WCPath", "addSegments");
+    env->CallVoidMethod(*m_platformPath, mid, (jintArray)jOps, (jfloatArray)jCoords);
+    WTF::CheckAndClearException(env);
+
+    m_pendingOps.clear();
+    m_pendingCoords.clear();
+}
+
 bool PathJava::definitelyEqual(const PathImpl& otherImpl) const
 {
     RefPtr otherAsPathJava = dynamicDowncast<PathJava>(otherImpl);
@@ -158,61 +198,27 @@ void PathJava::add(PathContinuousRoundedRect continuousRoundedRect)
 
 void PathJava::add(PathMoveTo moveto)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "moveTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)moveto.point.x(), (jdouble)moveto.point.y());
-    WTF::CheckAndClearException(env);
+    appendSegment(SEGMENT(MOVETO), { moveto.point.x(), moveto.point.y() });
 }
 
 void PathJava::add(PathLineTo lineTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addLineTo",
-        "(DD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)lineTo.point.x(), (jdouble)lineTo.point.y());
-    WTF::CheckAndClearException(env);
+    appendSegment(SEGMENT(LINETO), { lineTo.point.x(), lineTo.point.y() });
 }
 
 void PathJava::add(PathQuadCurveTo quadTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addQuadCurveTo",
-                                            "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)quadTo.controlPoint.x(), (jdouble)quadTo.controlPoint.y(), (jdouble)quadTo.endPoint.x(), (jdouble)quadTo.endPoint.y());
-    WTF::CheckAndClearException(env);
+    appendSegment(SEGMENT(QUADTO), {
+        quadTo.controlPoint.x(), quadTo.controlPoint.y(),
+        quadTo.endPoint.x(), quadTo.endPoint.y() });
 }
 
 void PathJava::add(PathBezierCurveTo bezierTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "addBezierCurveTo", "(DDDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)bezierTo.controlPoint1.x(), (jdouble)bezierTo.controlPoint1.y(),
-                        (jdouble)bezierTo.controlPoint2.x(), (jdouble)bezierTo.controlPoint2.y(),
-                        (jdouble)bezierTo.endPoint.x(), (jdouble)bezierTo.endPoint.y());
-    WTF::CheckAndClearException(env);
+    appendSegment(SEGMENT(CUBICTO), {
+        bezierTo.controlPoint1.x(), bezierTo.controlPoint1.y(),
+        bezierTo.controlPoint2.x(), bezierTo.controlPoint2.y(),
+        bezierTo.endPoint.x(), bezierTo.endPoint.y() });
 }
 
 static inline float areaOfTriangleFormedByPoints(const FloatPoint& p1, const FloatPoint& p2, const FloatPoint& p3)
@@ -222,23 +228,13 @@ static inline float areaOfTriangleFormedByPoints(const FloatPoint& p1, const Flo
 
 void PathJava::add(PathArcTo arcTo)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArcTo",
-        "(DDDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)arcTo.controlPoint1.x(), (jdouble)arcTo.controlPoint1.y(),
-                        (jdouble)arcTo.controlPoint2.x(), (jdouble)arcTo.controlPoint2.y(), (jdouble)arcTo.radius);
-    WTF::CheckAndClearException(env);
+    appendSegment(SEGMENT(ARCTO), {
+        arcTo.controlPoint1.x(), arcTo.controlPoint1.y(),
+        arcTo.controlPoint2.x(), arcTo.controlPoint2.y(), arcTo.radius });
 }
 
 void PathJava::add(PathArc arc)
 {
-    ASSERT(m_platformPath);
     bool clockwise = false;
     const RotationDirection direction = arc.direction;
     if (direction == RotationDirection::Counterclockwise) {
@@ -247,16 +243,9 @@ void PathJava::add(PathArc arc)
         clockwise = false;
     }
 
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addArc",
-        "(DDDDDZ)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)arc.center.x(), (jdouble)arc.center.y(),
-        (jdouble)arc.radius, (jdouble)arc.startAngle, (jdouble)arc.endAngle,
-        bool_to_jbool(clockwise));
-    WTF::CheckAndClearException(env);
+    appendSegment(SEGMENT(ARC), {
+        arc.center.x(), arc.center.y(), arc.radius,
+        arc.startAngle, arc.endAngle, clockwise ? 1.0f : 0.0f });
 }
 void PathJava::add(PathClosedArc closedArc)
 {
@@ -270,32 +259,15 @@ void PathJava::add(PathEllipse ellipse)
 
 void PathJava::add(PathEllipseInRect ellipseInRect)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addEllipse",
-        "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid,
-                        (jdouble)ellipseInRect.rect.x(), (jdouble)ellipseInRect.rect.y(),
-                        (jdouble)ellipseInRect.rect.width(), (jdouble)ellipseInRect.rect.height());
-    WTF::CheckAndClearException(env);
+    appendSegment(SEGMENT(ELLIPSE), {
+        ellipseInRect.rect.x(), ellipseInRect.rect.y(),
+        ellipseInRect.rect.width(), ellipseInRect.rect.height() });
 }
 
 void PathJava::add(PathRect rect)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env), "addRect",
-        "(DDDD)V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid, (jdouble)rect.rect.x(), (jdouble)rect.rect.y(),
-                              (jdouble)rect.rect.width(), (jdouble)rect.rect.height());
-    WTF::CheckAndClearException(env);
+    appendSegment(SEGMENT(RECT), {
+        rect.rect.x(), rect.rect.y(), rect.rect.width(), rect.rect.height() });
 }
 
 void PathJava::add(PathRoundedRect roundedRect)
@@ -306,16 +278,7 @@ void PathJava::add(PathRoundedRect roundedRect)
 
 void PathJava::add(PathCloseSubpath)
 {
-    ASSERT(m_platformPath);
-
-    JNIEnv* env = WTF::GetJavaEnv();
-
-    static jmethodID mid = env->GetMethodID(PG_GetPathClass(env),
-        "closeSubpath", "()V");
-    ASSERT(mid);
-
-    env->CallVoidMethod(*m_platformPath, mid);
-    WTF::CheckAndClearException(env);
+    appendSegment(SEGMENT(CLOSE), { });
 }
 
 void PathJava::addPath(const PathJava& path, const AffineTransform& transform)
@@ -359,6 +322,7 @@ bool PathJava::applyElements(const PathElementApplier& applier) const
 bool PathJava::isEmpty() const
 {
     ASSERT(m_platformPath);
+    flushSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -382,6 +346,7 @@ FloatPoint PathJava::currentPoint() const
 bool PathJava::transform(const AffineTransform& transform)
 {
     ASSERT(m_platformPath);
+    flushSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -403,6 +368,7 @@ bool PathJava::contains(const FloatPoint &point, WindRule rule) const
         return false;
 
     ASSERT(m_platformPath);
+    flushSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -421,6 +387,7 @@ bool PathJava::strokeContains(const FloatPoint& p, const Function<void(GraphicsC
 {
     ASSERT(m_platformPath);
     ASSERT(strokeStyleApplier);
+    flushSegments();
 
     GraphicsContext& gc = scratchContext();
     gc.save();
@@ -473,6 +440,7 @@ FloatRect PathJava::boundingRect() const
 FloatRect PathJava::strokeBoundingRect(const Function<void(GraphicsContext&)>& strokeStyleApplier) const
 {
     ASSERT(m_platformPath);
+    flushSegments();
 
     JNIEnv* env = WTF::GetJavaEnv();
 
@@ -515,3 +483,5 @@ FloatRect PathJava::strokeBoundingRect(const Function<void(GraphicsContext&)>& s
 }
 
 } // namespace WebCore
+
+#undef SEGMENT
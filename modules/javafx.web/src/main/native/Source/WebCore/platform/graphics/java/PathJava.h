@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2023, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -30,6 +30,8 @@
 #include "PlatformPath.h"
 #include "RQRef.h"
 #include "WindRule.h"
+#include <jni.h>
+#include <wtf/Vector.h>
 
 namespace WebCore {
 
@@ -85,8 +87,15 @@ private:
     FloatRect fastBoundingRect() const final;
     FloatRect boundingRect() const final;
 
+    // Segments are recorded natively and handed to the java WCPath in
+    // one call the next time the platform path is needed.
+    void appendSegment(jint op, std::initializer_list<jfloat> coords);
+    void flushSegments() const;
+
     RefPtr<RQRef> m_platformPath;
     RefPtr<PathStream> m_elementsStream;
+    mutable Vector<jint> m_pendingOps;
+    mutable Vector<jfloat> m_pendingCoords;
 };
 
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,39 +27,114 @@
 
 #include "RQRef.h"
 
+#include <limits>
+#include <wtf/Lock.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Vector.h>
+
 namespace WebCore {
 
-RQRef::~RQRef()
+namespace {
+
+// The references assigned since the last takeUpdates, kept alive until java
+// has them, and the ids released since then.
+struct PendingUpdates {
+    Vector<RefPtr<RQRef>> assigned;
+    Vector<jint> released;
+};
+
+Lock s_pendingLock;
+jint s_lastRefID = 0;
+
+PendingUpdates& pendingUpdates() WTF_REQUIRES_LOCK(s_pendingLock)
+{
+    static NeverDestroyed<PendingUpdates> updates;
+    return updates.get();
+}
+
+JLocalRef<jintArray> createIntArray(JNIEnv* env, const Vector<jint>& values)
 {
-    if (-1 != m_refID) {
-        JNIEnv* env = WTF::GetJavaEnv();
+    JLocalRef<jintArray> array(env->NewIntArray(values.size()));
+    if (WTF::CheckAndClearException(env) || !array) {
+        return { };
+    }
+    env->SetIntArrayRegion(array, 0, values.size(), values.data());
+    return array;
+}
 
-        if (env) {
-            //do it if JVM is here.
-            static jmethodID mid = env->GetMethodID(PG_GetRefClass(env), "deref", "()V");
-            ASSERT(mid);
-            env->CallVoidMethod(m_ref, mid);
+} // namespace
 
-            WTF::CheckAndClearException(env);
-        }
+RQRef::~RQRef()
+{
+    if (m_refID) {
+        Locker locker { s_pendingLock };
+        pendingUpdates().released.append(m_refID);
+        WTF::PerfCounters::add(WTF::PerfCounters::Counter::RQRefReleased);
     }
 }
 
 RQRef::operator jint() {
-    if (-1 == m_refID) {
-        JNIEnv* env = WTF::GetJavaEnv();
+    if (!m_refID) {
+        Locker locker { s_pendingLock };
+        // Java ids count up from 1, so the native ones count down from -1.
+        if (s_lastRefID == std::numeric_limits<jint>::min()) {
+            s_lastRefID = 0;
+        }
+        m_refID = --s_lastRefID;
+        pendingUpdates().assigned.append(this);
+        WTF::PerfCounters::add(WTF::PerfCounters::Counter::RQRefAssigned);
+    }
+    return m_refID;
+}
 
-        static jmethodID midGetId = env->GetMethodID(PG_GetRefClass(env), "getID", "()I");
-        ASSERT(midGetId);
-        m_refID = env->CallIntMethod(m_ref, midGetId);
+RQRef::Updates::Updates(JNIEnv* env)
+{
+    {
+        Locker locker { s_pendingLock };
+        m_assigned = std::exchange(pendingUpdates().assigned, { });
+        m_released = std::exchange(pendingUpdates().released, { });
+    }
+    if (m_assigned.isEmpty() && m_released.isEmpty()) {
+        return;
+    }
 
-        static jmethodID midRef = env->GetMethodID(PG_GetRefClass(env), "ref", "()V");
-        ASSERT(midRef);
-        env->CallVoidMethod(m_ref, midRef);
+    static JGClass clsObject(env->FindClass("java/lang/Object"));
 
-        WTF::CheckAndClearException(env);
+    Vector<jint> assignedIDs(m_assigned.size(), [&](size_t i) {
+        return m_assigned[i]->m_refID;
+    });
+    JLocalRef<jintArray> jAssignedIDs(createIntArray(env, assignedIDs));
+    JLocalRef<jintArray> jReleased(createIntArray(env, m_released));
+    if (!jAssignedIDs || !jReleased) {
+        restore();
+        return;
     }
-    return m_refID;
+    JLObjectArray assignedRefs(env->NewObjectArray(m_assigned.size(), clsObject, nullptr));
+    if (WTF::CheckAndClearException(env) || !assignedRefs) {
+        restore();
+        return;
+    }
+    JLObjectArray updates(env->NewObjectArray(3, clsObject, nullptr));
+    if (WTF::CheckAndClearException(env) || !updates) {
+        restore();
+        return;
+    }
+    for (size_t i = 0; i < m_assigned.size(); ++i) {
+        env->SetObjectArrayElement(assignedRefs, i, m_assigned[i]->m_ref);
+    }
+    env->SetObjectArrayElement(updates, 0, jAssignedIDs);
+    env->SetObjectArrayElement(updates, 1, assignedRefs);
+    env->SetObjectArrayElement(updates, 2, jReleased);
+    m_array = JLObjectArray(updates.releaseLocal());
+}
+
+void RQRef::Updates::restore()
+{
+    // They go back ahead of any updates made in the meantime so that the
+    // next batch still sends them in order.
+    Locker locker { s_pendingLock };
+    pendingUpdates().assigned.insertVector(0, std::exchange(m_assigned, { }));
+    pendingUpdates().released.insertVector(0, std::exchange(m_released, { }));
 }
 
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,9 +29,19 @@
 #include "PlatformJavaClasses.h"
 #include <wtf/RefCounted.h>
 #include <wtf/RefPtr.h>
+#include <wtf/Vector.h>
 
 namespace WebCore {
 
+/*
+ * A java com.sun.webkit.graphics.Ref written into a RenderingQueue.
+ *
+ * The id of the reference is assigned on the native side the first time it
+ * is written, from a range of negative numbers that the java side never hands
+ * out. Java learns about the references assigned and released since the last
+ * time in one batch (see Updates) rather than through a ref/deref call
+ * per object.
+ */
 class RQRef : public RefCounted<RQRef> {
 public:
     inline static RefPtr<RQRef> create(const JLObject &obj)
@@ -45,10 +55,36 @@ public:
     }
     ~RQRef();
 
+    // The references assigned and released since the previous batch, taken
+    // from the pending lists on construction. Must be taken before any
+    // buffer holding one of the assigned ids is handed to java.
+    class Updates {
+        WTF_MAKE_NONCOPYABLE(Updates);
+    public:
+        explicit Updates(JNIEnv*);
+
+        // {int[] assigned ids, Object[] their objects, int[] released ids}
+        // for WCGraphicsManager.updateRefs, or null if nothing changed since
+        // the previous batch. If the arrays cannot be created, this is null
+        // too and the updates are kept for the next batch.
+        jobjectArray array() const { return m_array; }
+        jobjectArray releaseArray() { return m_array.releaseLocal(); }
+
+        // Puts the updates back for the next batch, for when the call that
+        // was to hand them to java failed.
+        void restore();
+
+    private:
+        // Kept alive until the batch has been handed to java.
+        Vector<RefPtr<RQRef>> m_assigned;
+        Vector<jint> m_released;
+        JLObjectArray m_array;
+    };
+
 private:
     RQRef(const JLObject &obj)
         : m_ref(obj)
-        , m_refID(-1)
+        , m_refID(0)
     {}
 
     JGObject m_ref;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,26 +25,85 @@
 
 #include "config.h"
 
+#include "GraphicsTypes.h"
 #include "PlatformJavaClasses.h"
 #include "RenderingQueue.h"
 #include "RQRef.h"
 
 #include <wtf/java/JavaRef.h>
-#include <wtf/HashMap.h>
 #include <wtf/NeverDestroyed.h>
 
+#include "com_sun_webkit_graphics_GraphicsDecoder.h"
 #include "com_sun_webkit_graphics_WCRenderQueue.h"
 
 namespace WebCore {
 
-typedef HashMap<char*, RefPtr<ByteBuffer> > Addr2ByteBuffer;
+JLObject ByteBufferPool::Slot::directByteBuffer(JNIEnv* env)
+{
+    if (!m_nioBuffer) {
+        m_nioBuffer = JLObject(env->NewDirectByteBuffer(m_address, m_capacity));
+    }
+    return JLObject(m_nioBuffer, true);
+}
+
+JLObjectArray ByteBuffer::createRefArray(JNIEnv* env)
+{
+    static JGClass clsObject(env->FindClass("java/lang/Object"));
+
+    JLObjectArray refs(env->NewObjectArray(m_refList.size(), clsObject, nullptr));
+    if (WTF::CheckAndClearException(env) || !refs) {
+        return { };
+    }
+    for (size_t i = 0; i < m_refList.size(); ++i) {
+        env->SetObjectArrayElement(refs, i, jobject(*m_refList[i]));
+    }
+    return refs;
+}
+
+JLocalRef<jintArray> ByteBuffer::createRefIDArray(JNIEnv* env)
+{
+    Vector<jint> values(m_refList.size(), [&](size_t i) {
+        return static_cast<jint>(*m_refList[i]);
+    });
+    JLocalRef<jintArray> ids(env->NewIntArray(values.size()));
+    if (WTF::CheckAndClearException(env) || !ids) {
+        return { };
+    }
+    env->SetIntArrayRegion(ids, 0, values.size(), values.data());
+    return ids;
+}
+
+ByteBufferPool& ByteBufferPool::shared()
+{
+    static NeverDestroyed<ByteBufferPool> pool;
+    return pool.get();
+}
+
+ByteBufferPool::ByteBufferPool()
+    : m_slotCapacity(com_sun_webkit_graphics_WCRenderQueue_MAX_QUEUE_SIZE / RenderingQueue::MAX_BUFFER_COUNT)
+{
+}
+
+std::unique_ptr<ByteBufferPool::Slot> ByteBufferPool::acquire(int capacity)
+{
+    if (capacity == m_slotCapacity && !m_freeSlots.isEmpty()) {
+        WTF::PerfCounters::add(WTF::PerfCounters::Counter::RenderingQueuePoolHits);
+        return m_freeSlots.takeLast();
+    }
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::RenderingQueuePoolMisses);
+    return std::make_unique<Slot>(capacity);
+}
 
-static Addr2ByteBuffer& getAddr2ByteBuffer()
+void ByteBufferPool::recycle(std::unique_ptr<Slot> slot)
 {
-    static NeverDestroyed<Addr2ByteBuffer> container;
-    return container.get();
+    if (slot && slot->capacity() == m_slotCapacity
+            && m_freeSlots.size() < MAX_POOLED_BUFFER_COUNT) {
+        m_freeSlots.append(WTFMove(slot));
+    }
 }
 
+bool RenderingQueue::s_isRecording = false;
+
 /*static*/
 RefPtr<RenderingQueue> RenderingQueue::create(
     const JLObject &jRQ,
@@ -57,6 +116,208 @@ RefPtr<RenderingQueue> RenderingQueue::create(
         autoFlush));
 }
 
+namespace {
+
+// Where each RenderingQueue::StateSlot starts in State::words, in the order
+// of the enum, followed by the total size.
+constexpr unsigned s_stateSlotOffsets[RenderingQueue::StateSlotCount + 1] = {
+    0,  // FillColor: r, g, b, a
+    4,  // StrokeColor: r, g, b, a
+    8,  // StrokeThickness
+    9,  // StrokeStyle
+    10, // TextMode: fill, stroke, clip
+    13, // Alpha
+    14, // Composite
+    15, // Shadow: dx, dy, blur, r, g, b, a
+    22, // LineCap
+    23, // LineJoin
+    24, // MiterLimit
+    25, // PerspectiveTransform: m11 .. m44
+    41
+};
+
+constexpr uint32_t stateBit(RenderingQueue::StateSlot slot)
+{
+    return 1u << static_cast<unsigned>(slot);
+}
+
+} // namespace
+
+RenderingQueue::RenderingQueue(const JLObject& jRQ, int capacity, bool autoFlush) :
+    m_rqoRenderingQueue(RQRef::create(jRQ)),
+    m_capacity(capacity),
+    m_autoFlush(autoFlush),
+    m_buffer(nullptr)
+{
+    static_assert(s_stateSlotOffsets[StateSlotCount] == State::WordCount);
+
+    // Every queue is decoded into a graphics context that starts in the
+    // state set up by WCGraphicsPrismContext.ContextState. The alpha is not
+    // known, as it comes from the node being painted.
+    const jint black[] = { toStateWord(0.f), toStateWord(0.f), toStateWord(0.f), toStateWord(1.f) };
+    m_state.set(StateSlot::FillColor, black, 4);
+    m_state.set(StateSlot::StrokeColor, black, 4);
+    const jint textMode[] = { 1, 0, 0 };
+    m_state.set(StateSlot::TextMode, textMode, 3);
+    const jint composite[] = { static_cast<jint>(CompositeOperator::SourceOver) };
+    m_state.set(StateSlot::Composite, composite, 1);
+    const jint noShadow[7] = { };
+    m_state.set(StateSlot::Shadow, noShadow, 7);
+    jint identity[16] = { };
+    identity[0] = identity[5] = identity[10] = identity[15] = toStateWord(1.f);
+    m_state.set(StateSlot::PerspectiveTransform, identity, 16);
+}
+
+bool RenderingQueue::State::matches(StateSlot slot, const jint* values, unsigned count) const
+{
+    unsigned offset = s_stateSlotOffsets[static_cast<unsigned>(slot)];
+    ASSERT(offset + count == s_stateSlotOffsets[static_cast<unsigned>(slot) + 1]);
+    return (known & stateBit(slot))
+        && std::equal(values, values + count, words.begin() + offset);
+}
+
+void RenderingQueue::State::set(StateSlot slot, const jint* values, unsigned count)
+{
+    unsigned offset = s_stateSlotOffsets[static_cast<unsigned>(slot)];
+    ASSERT(offset + count == s_stateSlotOffsets[static_cast<unsigned>(slot) + 1]);
+    std::copy(values, values + count, words.begin() + offset);
+    known |= stateBit(slot);
+}
+
+bool RenderingQueue::updateState(StateSlot slot, const jint* words, unsigned count)
+{
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::RenderingQueueTrackedCommands);
+    if (m_state.matches(slot, words, count)) {
+        elide(1, 4 * (1 + count));
+        return false;
+    }
+    m_state.set(slot, words, count);
+    return true;
+}
+
+void RenderingQueue::elide(unsigned commands, int bytes)
+{
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::RenderingQueueElidedCommands, commands);
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::RenderingQueueElidedBytes, bytes);
+}
+
+void RenderingQueue::saveState()
+{
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::RenderingQueueTrackedCommands);
+    freeSpace(4) << (jint)com_sun_webkit_graphics_GraphicsDecoder_SAVESTATE;
+    m_savedStates.append({ m_state, m_flushedBufferCount, m_buffer->position() });
+}
+
+void RenderingQueue::restoreState()
+{
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::RenderingQueueTrackedCommands);
+    if (m_savedStates.isEmpty()) {
+        // Unbalanced; assume nothing about what java ends up with.
+        m_state.known = 0;
+    } else {
+        SavedState saved = m_savedStates.takeLast();
+        m_state = saved.state;
+        if (m_buffer && saved.bufferIndex == m_flushedBufferCount
+            && saved.position == m_buffer->position()) {
+            // Nothing was written since the matching SAVESTATE.
+            m_buffer->rewind(saved.position - 4);
+            elide(2, 8);
+            return;
+        }
+    }
+    freeSpace(4) << (jint)com_sun_webkit_graphics_GraphicsDecoder_RESTORESTATE;
+}
+
+void RenderingQueue::beginTransparencyLayer(jfloat opacity)
+{
+    freeSpace(8)
+    << (jint)com_sun_webkit_graphics_GraphicsDecoder_BEGINTRANSPARENCYLAYER
+    << opacity;
+    m_savedStates.append({ m_state, m_flushedBufferCount, -1 });
+    // The layer may reset the composite operation of the new state.
+    invalidateState(StateSlot::Composite);
+}
+
+void RenderingQueue::endTransparencyLayer()
+{
+    freeSpace(4)
+    << (jint)com_sun_webkit_graphics_GraphicsDecoder_ENDTRANSPARENCYLAYER;
+    if (m_savedStates.isEmpty())
+        m_state.known = 0;
+    else
+        m_state = m_savedStates.takeLast().state;
+}
+
+void RenderingQueue::fillRect(jfloat x, jfloat y, jfloat w, jfloat h)
+{
+    putFillRect(com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFF, x, y, w, h, nullptr, 20);
+}
+
+void RenderingQueue::fillRect(jfloat x, jfloat y, jfloat w, jfloat h,
+                              jfloat r, jfloat g, jfloat b, jfloat a)
+{
+    const jfloat color[] = { r, g, b, a };
+    putFillRect(com_sun_webkit_graphics_GraphicsDecoder_FILLRECT_FFFFI, x, y, w, h, color, 36);
+}
+
+void RenderingQueue::putFillRect(jint opcode, jfloat x, jfloat y, jfloat w, jfloat h,
+                                 const jfloat* color, int size)
+{
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::RenderingQueueTrackedCommands);
+
+    auto& last = m_lastFillRect;
+    // The two rectangles only render as one when they do not interact:
+    // without a shadow, and with source-over compositing.
+    unsigned shadow = s_stateSlotOffsets[static_cast<unsigned>(StateSlot::Shadow)];
+    bool canExtend = m_buffer
+        && last.bufferIndex == m_flushedBufferCount
+        && last.end == m_buffer->position()
+        && last.opcode == opcode
+        && w > 0 && h > 0
+        && (!color || std::equal(color, color + 4, last.args.begin() + 4))
+        && hasState(StateSlot::Composite, static_cast<jint>(CompositeOperator::SourceOver))
+        && (m_state.known & stateBit(StateSlot::Shadow))
+        && !m_state.words[shadow] && !m_state.words[shadow + 1] && !m_state.words[shadow + 2];
+
+    if (canExtend) {
+        jfloat lx = last.args[0], ly = last.args[1], lw = last.args[2], lh = last.args[3];
+        bool extended = true;
+        if (y == ly && h == lh && (x == lx + lw || x + w == lx)) {
+            lx = std::min(x, lx);
+            lw += w;
+        } else if (x == lx && w == lw && (y == ly + lh || y + h == ly)) {
+            ly = std::min(y, ly);
+            lh += h;
+        } else {
+            extended = false;
+        }
+        if (extended) {
+            int rect = last.end - size + 4;
+            m_buffer->putFloatAt(rect, lx);
+            m_buffer->putFloatAt(rect + 4, ly);
+            m_buffer->putFloatAt(rect + 8, lw);
+            m_buffer->putFloatAt(rect + 12, lh);
+            last.args[0] = lx;
+            last.args[1] = ly;
+            last.args[2] = lw;
+            last.args[3] = lh;
+            elide(1, size);
+            return;
+        }
+    }
+
+    freeSpace(size) << opcode << x << y << w << h;
+    if (color)
+        *this << color[0] << color[1] << color[2] << color[3];
+
+    last.bufferIndex = m_flushedBufferCount;
+    last.end = m_buffer->position();
+    last.opcode = opcode;
+    last.args = { x, y, w, h };
+    if (color)
+        std::copy(color, color + 4, last.args.begin() + 4);
+}
+
 RenderingQueue& RenderingQueue::freeSpace(int size) {
     if (m_buffer && !m_buffer->hasFreeSpace(size)) {
         flushBuffer();
@@ -77,6 +338,8 @@ void RenderingQueue::flush() {
             PG_GetRenderQueueClass(env), "fwkFlush", "()V");
     ASSERT(midFwkFlush);
 
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::RenderingQueueFlushes);
+    LOG_PERF_RECORD("WCRenderQueue", "fwkFlush");
     env->CallVoidMethod(getWCRenderingQueue(), midFwkFlush);
     WTF::CheckAndClearException(env);
 }
@@ -106,26 +369,62 @@ RenderingQueue& RenderingQueue::flushBuffer() {
     JNIEnv* env = WTF::GetJavaEnv();
 
     static jmethodID midFwkAddBuffer = env->GetMethodID(PG_GetRenderQueueClass(env),
-        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;)V");
+        "fwkAddBuffer", "(Ljava/nio/ByteBuffer;IJ[Ljava/lang/Object;)V");
     ASSERT(midFwkAddBuffer);
 
-    Addr2ByteBuffer &a2bb = getAddr2ByteBuffer();
-    a2bb.set(m_buffer->bufferAddress(), m_buffer);
-    env->CallVoidMethod(
-        getWCRenderingQueue(),
-        midFwkAddBuffer,
-        (jobject)(m_buffer->createDirectByteBuffer(env)));
-    WTF::CheckAndClearException(env);
+    // The reference is adopted back in twkRelease once java is done with the buffer.
+    JLObject jBuffer(m_buffer->createDirectByteBuffer(env));
+    // Every id in the buffer has been assigned by now, so java learns about
+    // the new ones before it sees the buffer.
+    RQRef::Updates refUpdates(env);
+    jint size = m_buffer->position();
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::RenderingQueueBuffers);
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::RenderingQueueBytes, size);
+    ByteBuffer* buffer = m_buffer.leakRef();
+    if (s_isRecording) {
+        static jmethodID midFwkAddRecordedBuffer = env->GetMethodID(PG_GetRenderQueueClass(env),
+            "fwkAddRecordedBuffer", "(Ljava/nio/ByteBuffer;IJ[Ljava/lang/Object;[I[Ljava/lang/Object;)V");
+        ASSERT(midFwkAddRecordedBuffer);
+
+        JLocalRef<jintArray> jRefIDs(buffer->createRefIDArray(env));
+        JLObjectArray jRefs(buffer->createRefArray(env));
+        env->CallVoidMethod(
+            getWCRenderingQueue(),
+            midFwkAddRecordedBuffer,
+            (jobject)jBuffer,
+            size,
+            ptr_to_jlong(buffer),
+            refUpdates.array(),
+            (jintArray)jRefIDs,
+            (jobjectArray)jRefs);
+    } else {
+        LOG_PERF_RECORD("WCRenderQueue", "fwkAddBuffer");
+        env->CallVoidMethod(
+            getWCRenderingQueue(),
+            midFwkAddBuffer,
+            (jobject)jBuffer,
+            size,
+            ptr_to_jlong(buffer),
+            refUpdates.array());
+    }
+    if (WTF::CheckAndClearException(env)) {
+        // Java has not queued the buffer (see fwkAddBuffer), so it is dropped
+        // here. The updates go again with the next buffer, ahead of the
+        // releases this causes.
+        refUpdates.restore();
+        RefPtr<ByteBuffer> dropped = adoptRef(buffer);
+    }
 
     m_buffer = nullptr;
+    ++m_flushedBufferCount;
 
     return *this;
 }
 }
 
 
-JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
-    (JNIEnv* env, jobject, jobjectArray bufs)
+JNIEXPORT jobjectArray JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
+    (JNIEnv* env, jobject, jlongArray bufs)
 {
     using namespace WebCore;
     /*
@@ -134,12 +433,26 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkRelease
      * so when a resource is dereferenced (as a result of ByteBuffer destruction)
      * it should be thread safe.
      */
-    Addr2ByteBuffer& a2bb = getAddr2ByteBuffer();
-    for (int i = 0; i < env->GetArrayLength(bufs); ++i) {
-        char *key = (char *)env->GetDirectBufferAddress(
-            JLObject(env->GetObjectArrayElement(bufs, i)));
-        if (key != 0) {
-            a2bb.remove(key);
+    jsize count = env->GetArrayLength(bufs);
+    jlong* handles = env->GetLongArrayElements(bufs, nullptr);
+    if (!handles) {
+        return nullptr;
+    }
+    for (jsize i = 0; i < count; ++i) {
+        if (handles[i]) {
+            // Drops the native buffer; its memory returns to ByteBufferPool.
+            RefPtr<ByteBuffer> buffer = adoptRef(static_cast<ByteBuffer*>(jlong_to_ptr(handles[i])));
         }
     }
+    env->ReleaseLongArrayElements(bufs, handles, JNI_ABORT);
+
+    // The references held by the buffers go back to java in one batch.
+    RQRef::Updates refUpdates(env);
+    return refUpdates.releaseArray();
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_graphics_WCRenderQueue_twkSetRecording
+    (JNIEnv*, jclass, jboolean recording)
+{
+    WebCore::RenderingQueue::setRecording(jbool_to_bool(recording));
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,10 +25,14 @@
 
 #pragma once
 
+#include <array>
+#include <bit>
 #include <jni.h>
 #include <wtf/Vector.h>
 #include <wtf/RefCounted.h>
 #include <wtf/HashSet.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/Noncopyable.h>
 #include <wtf/java/DbgUtils.h>
 
 #include "RQRef.h"
@@ -37,22 +41,77 @@ namespace WebCore {
 
 class RQRef;
 
+/*
+ * Keeps the native memory of released ByteBuffer instances, together with the
+ * direct java.nio.ByteBuffer that wraps it, for reuse by subsequent flushes.
+ * Only blocks of the default RenderingQueue capacity are pooled; larger ones
+ * (needed for a single oversized command) are allocated and freed as before.
+ * The pool is accessed on the Event thread only.
+ */
+class ByteBufferPool {
+    WTF_MAKE_NONCOPYABLE(ByteBufferPool);
+public:
+    static const size_t MAX_POOLED_BUFFER_COUNT = 32;
+
+    class Slot {
+        WTF_MAKE_NONCOPYABLE(Slot);
+    public:
+        Slot(int capacity) :
+            m_address(new char[capacity]),
+            m_capacity(capacity)
+        {}
+
+        ~Slot() {
+            m_nioBuffer.clear();
+            delete[] m_address;
+        }
+
+        char* address() { return m_address; }
+        int capacity() { return m_capacity; }
+
+        // The same wrapper is handed to java every time the slot is reused.
+        JLObject directByteBuffer(JNIEnv* env);
+
+    private:
+        char* m_address;
+        int m_capacity;
+        JGObject m_nioBuffer;
+    };
+
+    static ByteBufferPool& shared();
+
+    std::unique_ptr<Slot> acquire(int capacity);
+    void recycle(std::unique_ptr<Slot> slot);
+
+private:
+    friend class NeverDestroyed<ByteBufferPool>;
+    ByteBufferPool();
+
+    int m_slotCapacity;
+    Vector<std::unique_ptr<Slot>> m_freeSlots;
+};
+
 class ByteBuffer : public RefCounted<ByteBuffer> {
     RQ_LOG_INSTANCE_COUNT(ByteBuffer)
 public:
     static RefPtr<ByteBuffer> create(int capacity) {
-        return adoptRef(new ByteBuffer(capacity));
+        return adoptRef(new ByteBuffer(ByteBufferPool::shared().acquire(capacity)));
     }
 
     JLObject createDirectByteBuffer(JNIEnv* env) {
         ASSERT(!isEmpty());
-        JLObject ret(env->NewDirectByteBuffer(m_buffer, m_position));
-        m_nio_holder = ret;
-        return ret;
+        return m_slot->directByteBuffer(env);
     }
 
+    // The java objects referenced from the buffer, for the recorder.
+    JLObjectArray createRefArray(JNIEnv* env);
+    // Their ids, in the same order.
+    JLocalRef<jintArray> createRefIDArray(JNIEnv* env);
+
     char* bufferAddress() { return m_buffer; }
 
+    int position() { return m_position; }
+
     void putRef(RefPtr<RQRef> ref) {
         ASSERT(m_position + sizeof(jint) <= m_capacity);
         RefPtr<RQRef> repeatable_use_holder(ref);
@@ -72,25 +131,40 @@ public:
         m_position += sizeof(jfloat);
     }
 
+    // Overwrites a float written earlier, e.g. to extend the rectangle
+    // of the last command.
+    void putFloatAt(int position, jfloat f) {
+        ASSERT(position >= 0 && position + sizeof(jfloat) <= m_position);
+        memcpy((m_buffer + position), &f, sizeof(jfloat));
+    }
+
+    // Drops everything written after the given position. Must not drop
+    // any reference.
+    void rewind(int position) {
+        ASSERT(position >= 0 && position <= m_position);
+        m_position = position;
+    }
+
     bool hasFreeSpace(int size) { return m_position + size <= m_capacity; }
 
     bool isEmpty() { return m_position == 0; }
 
     ~ByteBuffer() {
-        delete[] m_buffer;
+        ByteBufferPool::shared().recycle(WTFMove(m_slot));
     }
 
 private:
-    ByteBuffer(int capacity) :
-        m_buffer(new char[capacity]),
-        m_capacity(capacity),
+    ByteBuffer(std::unique_ptr<ByteBufferPool::Slot> slot) :
+        m_slot(WTFMove(slot)),
+        m_buffer(m_slot->address()),
+        m_capacity(m_slot->capacity()),
         m_position(0)
     {}
 
+    std::unique_ptr<ByteBufferPool::Slot> m_slot;
     char* m_buffer;
     int m_capacity;
     int m_position;
-    JGObject m_nio_holder;
     Vector< RefPtr<RQRef> > m_refList;
 };
 
@@ -109,6 +183,24 @@ class RenderingQueue : public RefCounted<RenderingQueue> {
 public:
     static const size_t MAX_BUFFER_COUNT = 8;
 
+    // The parts of the java graphics context state that are mirrored on the
+    // native side, so that commands which would not change them are dropped.
+    enum class StateSlot : uint8_t {
+        FillColor,
+        StrokeColor,
+        StrokeThickness,
+        StrokeStyle,
+        TextMode,
+        Alpha,
+        Composite,
+        Shadow,
+        LineCap,
+        LineJoin,
+        MiterLimit,
+        PerspectiveTransform,
+    };
+    static constexpr unsigned StateSlotCount = 12;
+
     static RefPtr<RenderingQueue> create(
         const JLObject &jRQ,
         int capacity,
@@ -134,10 +226,59 @@ public:
     RenderingQueue& freeSpace(int size);
     RenderingQueue& flushBuffer();
 
+    // Writes a command that sets the given state slot to the arguments,
+    // unless the java graphics context is known to be in that state.
+    template<typename... Args>
+    void putState(StateSlot slot, jint opcode, Args... args) {
+        const jint words[] = { toStateWord(args)... };
+        if (!updateState(slot, words, sizeof...(Args)))
+            return;
+        freeSpace(4 * (1 + sizeof...(Args))) << opcode;
+        (*this << ... << args);
+    }
+
+    template<typename... Args>
+    bool hasState(StateSlot slot, Args... args) const {
+        const jint words[] = { toStateWord(args)... };
+        return m_state.matches(slot, words, sizeof...(Args));
+    }
+
+    // For commands that change a slot as a side effect, like a gradient
+    // replacing the fill color.
+    void invalidateState(StateSlot slot) {
+        m_state.known &= ~(1u << static_cast<unsigned>(slot));
+    }
+
+    // SAVESTATE and RESTORESTATE; a pair with nothing in between is dropped.
+    void saveState();
+    void restoreState();
+
+    // A transparency layer saves and restores the state like a SAVESTATE.
+    void beginTransparencyLayer(jfloat opacity);
+    void endTransparencyLayer();
+
+    // FILLRECT_FFFF and FILLRECT_FFFFI. A rectangle that continues the one
+    // filled by the previous command, with the same color, extends it.
+    void fillRect(jfloat x, jfloat y, jfloat w, jfloat h);
+    void fillRect(jfloat x, jfloat y, jfloat w, jfloat h,
+                  jfloat r, jfloat g, jfloat b, jfloat a);
+
     bool isEmpty() {
         return m_buffer == nullptr || m_buffer->isEmpty();
     }
 
+    // The number of buffers sent to Java so far. Together with isEmpty()
+    // it tells whether anything was drawn since an earlier point.
+    unsigned flushedBufferCount() const {
+        return m_flushedBufferCount;
+    }
+
+    // While recording, flushed buffers are sent to java together with the
+    // objects they reference, so that they can be written out and replayed.
+    static void setRecording(bool recording) {
+        s_isRecording = recording;
+    }
+
     JLObject getWCRenderingQueue() {
         return m_rqoRenderingQueue->cloneLocalCopy();
     }
@@ -153,16 +294,37 @@ public:
     }
 
 private:
-    RenderingQueue(const JLObject& jRQ, int capacity, bool autoFlush) :
-        m_rqoRenderingQueue(RQRef::create(jRQ)),
-        m_capacity(capacity),
-        m_autoFlush(autoFlush),
-        m_buffer(nullptr)
-    {}
+    RenderingQueue(const JLObject& jRQ, int capacity, bool autoFlush);
 
     void flush();
     void disposeGraphics();
 
+    static jint toStateWord(jint i) { return i; }
+    static jint toStateWord(jfloat f) { return std::bit_cast<jint>(f); }
+
+    // The arguments of the last command written for each slot, as raw words.
+    struct State {
+        static constexpr unsigned WordCount = 41;
+
+        bool matches(StateSlot, const jint* words, unsigned count) const;
+        void set(StateSlot, const jint* words, unsigned count);
+
+        std::array<jint, WordCount> words { };
+        uint32_t known { 0 };
+    };
+
+    struct SavedState {
+        State state;
+        unsigned bufferIndex;
+        int position; // just past the SAVESTATE command
+    };
+
+    // Returns whether the command has to be written.
+    bool updateState(StateSlot, const jint* words, unsigned count);
+    void putFillRect(jint opcode, jfloat x, jfloat y, jfloat w, jfloat h,
+                     const jfloat* color, int size);
+    void elide(unsigned commands, int bytes);
+
     //we need to have RQRef here due to [deref]
     //callback in destructor. Texture need to be released.
     RefPtr<RQRef> m_rqoRenderingQueue;
@@ -170,6 +332,20 @@ private:
     int m_capacity;
     bool m_autoFlush;
     RefPtr<ByteBuffer> m_buffer; // ref to the current ByteBuffer
+    unsigned m_flushedBufferCount { 0 };
+
+    State m_state;
+    Vector<SavedState> m_savedStates;
+
+    // The last fill rect command, while nothing has been written after it.
+    struct {
+        unsigned bufferIndex { 0 };
+        int end { -1 };
+        jint opcode { 0 };
+        std::array<jfloat, 8> args { };
+    } m_lastFillRect;
+
+    static bool s_isRecording;
 
 };
 } // namespace WebCore
@@ -25,6 +25,8 @@
 #if USE(TEXTURE_MAPPER)
 #if !PLATFORM(JAVA)
 #include "GLContext.h"
+#else
+#include "BitmapTextureJava.h"
 #endif
 #include "GraphicsContext.h"
 #include "GraphicsLayer.h"
@@ -84,10 +86,25 @@ GLenum depthBufferFormat()
     return GL_DEPTH_COMPONENT16;
 }
 
+#if PLATFORM(JAVA)
+static BitmapTextureJava::Flags javaTextureFlags(OptionSet<BitmapTexture::Flags> flags)
+{
+    BitmapTextureJava::Flags javaFlags = BitmapTextureJava::NoFlag;
+    if (flags.contains(BitmapTexture::Flags::SupportsAlpha))
+        javaFlags |= BitmapTextureJava::SupportsAlpha;
+    if (flags.contains(BitmapTexture::Flags::DepthBuffer))
+        javaFlags |= BitmapTextureJava::DepthBuffer;
+    return javaFlags;
+}
+#endif
+
 BitmapTexture::BitmapTexture(const IntSize& size, OptionSet<Flags> flags)
     : m_flags(flags)
     , m_size(size)
     , m_pixelFormat(PixelFormat::RGBA8)
+#if PLATFORM(JAVA)
+    , m_javaTexture(BitmapTextureJava::create())
+#endif
 {
 #if USE(GBM)
     if (m_flags.contains(Flags::BackedByDMABuf)) {
@@ -114,6 +131,9 @@ BitmapTexture::BitmapTexture(const IntSize& size, OptionSet<Flags> flags)
     allocateTexture();
 
     glBindTexture(GL_TEXTURE_2D, boundTexture);
+    #else
+    UNUSED_VARIABLE(boundTexture);
+    m_javaTexture->reset(m_size, javaTextureFlags(m_flags));
     #endif
 }
 
@@ -197,7 +217,15 @@ void BitmapTexture::reset(const IntSize& size, OptionSet<Flags> flags)
     // We don't support switching from dmabuf backing to regular textures -- there is no use-case for that scenario.
     RELEASE_ASSERT(m_flags.contains(Flags::BackedByDMABuf) == flags.contains(Flags::BackedByDMABuf));
 #endif
-#if !PLATFORM(JAVA)
+#if PLATFORM(JAVA)
+    m_flags = flags;
+    m_shouldClear = true;
+    m_pixelFormat = PixelFormat::RGBA8;
+    m_filterOperation = nullptr;
+    m_clipStack = { };
+    m_size = size;
+    m_javaTexture->reset(size, javaTextureFlags(flags));
+#else
     m_flags = flags;
     m_shouldClear = true;
     m_pixelFormat = PixelFormat::RGBA8;
@@ -276,7 +304,9 @@ void BitmapTexture::updateContents(const void* srcData, const IntRect& targetRec
         LOG_ERROR("BitmapTexture::updateContents(), failed to obtain MemoryMappedGPUBuffer write scope, fallback to OpenGL.");
     }
 #endif
-#if !PLATFORM(JAVA)
+#if PLATFORM(JAVA)
+    m_javaTexture->updateContents(srcData, targetRect, sourceOffset, bytesPerLine, pixelFormat);
+#else
     glBindTexture(GL_TEXTURE_2D, m_id);
 
     const unsigned bytesPerPixel = 4;
@@ -333,7 +363,9 @@ void BitmapTexture::updateContents(NativeImage* frameImage, const IntRect& targe
     if (!frameImage)
         return;
 
-#if USE(CAIRO)
+#if PLATFORM(JAVA)
+    m_javaTexture->updateContents(frameImage, targetRect, offset);
+#elif USE(CAIRO)
     cairo_surface_t* surface = frameImage->platformImage().get();
     const uint8_t* imageData = cairo_image_surface_get_data(surface);
     int bytesPerLine = cairo_image_surface_get_stride(surface);
@@ -353,6 +385,9 @@ void BitmapTexture::updateContents(NativeImage* frameImage, const IntRect& targe
 
 void BitmapTexture::updateContents(GraphicsLayer* sourceLayer, const IntRect& targetRect, const IntPoint& offset, float scale)
 {
+#if PLATFORM(JAVA)
+    m_javaTexture->updateContents(sourceLayer, targetRect, offset, scale);
+#else
     // Making an unconditionally unaccelerated buffer here is OK because this code
     // isn't used by any platforms that respect the accelerated bit.
     auto imageBuffer = ImageBuffer::create(targetRect.size(), RenderingMode::Unaccelerated, RenderingPurpose::Unspecified, 1, DestinationColorSpace::SRGB(), ImageBufferPixelFormat::BGRA8);
@@ -375,6 +410,7 @@ void BitmapTexture::updateContents(GraphicsLayer* sourceLayer, const IntRect& ta
         return;
 
     updateContents(image.get(), targetRect, IntPoint());
+#endif
 }
 
 void BitmapTexture::initializeStencil()
@@ -452,7 +488,14 @@ void BitmapTexture::createFboIfNeeded()
 
 void BitmapTexture::bindAsSurface()
 {
-#if !PLATFORM(JAVA)
+#if PLATFORM(JAVA)
+    // The backing buffer is cleared when the texture is reset, only the
+    // clip stack needs to start over.
+    if (m_shouldClear) {
+        m_clipStack.reset(IntRect(IntPoint::zero(), m_size), ClipStack::YAxisMode::Default);
+        m_shouldClear = false;
+    }
+#else
     glBindTexture(GL_TEXTURE_2D, 0);
     createFboIfNeeded();
     glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
@@ -45,6 +45,9 @@ typedef void *EGLImage;
 
 namespace WebCore {
 
+#if PLATFORM(JAVA)
+class BitmapTextureJava;
+#endif
 class GraphicsLayer;
 class NativeImage;
 class TextureMapper;
@@ -106,6 +109,10 @@ public:
     MemoryMappedGPUBuffer* memoryMappedGPUBuffer() const { return m_memoryMappedGPUBuffer.get(); }
 #endif
 
+#if PLATFORM(JAVA)
+    BitmapTextureJava& javaTexture() const { return m_javaTexture.get(); }
+#endif
+
 private:
     BitmapTexture(const IntSize&, OptionSet<Flags>);
 #if USE(GBM)
@@ -136,6 +143,9 @@ private:
 #if USE(GBM)
     std::unique_ptr<MemoryMappedGPUBuffer> m_memoryMappedGPUBuffer;
 #endif
+#if PLATFORM(JAVA)
+    const Ref<BitmapTextureJava> m_javaTexture;
+#endif
 };
 
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,32 +23,97 @@
  * questions.
  */
 
-#include "config.h"
 
+#include "config.h"
 #include "BitmapTextureJava.h"
-#include "GraphicsLayer.h"
-#include "NotImplemented.h"
-#include "PlatformContextJava.h"
-#include "TextureMapperJava.h"
-#include <stdio.h>
-namespace WebCore {
 
+#include "GraphicsContext.h"
+#include "GraphicsLayer.h"
+#include "NativeImage.h"
+#include "PixelBuffer.h"
+#include <wtf/java/PerfCounters.h>
 
-void BitmapTextureJava::updateContents(const void*, const IntRect& target, const IntPoint& sourceOffset, int bytesPerLine)
-{
-    notImplemented();
-}
+namespace WebCore {
 
 void BitmapTextureJava::didReset()
 {
+    if (contentSize().isEmpty()) {
+        m_image = nullptr;
+        return;
+    }
+
+    // Textures are reset whenever they are taken out of the pool or resized,
+    // so keep the backing buffer when its size still fits.
+    if (m_image && m_image->truncatedLogicalSize() == contentSize()) {
+        m_image->context().clearRect(FloatRect(FloatPoint(), contentSize()));
+        WTF::PerfCounters::add(WTF::PerfCounters::Counter::CompositingTextureReuses);
+        return;
+    }
+
     float devicePixelRatio = 1.0;
     m_image = ImageBuffer::create(contentSize(), RenderingMode::Unaccelerated, RenderingPurpose::Unspecified, devicePixelRatio,
                          DestinationColorSpace::SRGB(), ImageBufferPixelFormat::BGRA8);
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::CompositingTextureAllocations);
 }
 
-void BitmapTextureJava::updateContents(NativeImage* image, const IntRect& targetRect, const IntPoint& offset)
+void BitmapTextureJava::updateContents(const void* data, const IntRect& target, const IntPoint& sourceOffset, int bytesPerLine, PixelFormat pixelFormat)
 {
-    //m_image->context().drawImage(*image, targetRect, IntRect(offset, targetRect.size()));
+    if (!m_image || target.isEmpty())
+        return;
+
+    constexpr int bytesPerPixel = 4;
+    const int targetBytesPerLine = target.width() * bytesPerPixel;
+    Vector<uint8_t> pixels(targetBytesPerLine * target.height());
+    auto* destination = pixels.mutableSpan().data();
+    auto* source = static_cast<const uint8_t*>(data) + sourceOffset.y() * bytesPerLine + sourceOffset.x() * bytesPerPixel;
+    for (int y = 0; y < target.height(); ++y) {
+        memcpy(destination, source, targetBytesPerLine);
+        source += bytesPerLine;
+        destination += targetBytesPerLine;
+    }
+
+    PixelBufferFormat format { AlphaPremultiplication::Premultiplied, pixelFormat, DestinationColorSpace::SRGB() };
+    auto pixelBuffer = PixelBufferSourceView::create(format, target.size(), pixels.span());
+    if (!pixelBuffer)
+        return;
+
+    m_image->putPixelBuffer(*pixelBuffer, IntRect(IntPoint(), target.size()), target.location());
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::CompositingTextureUpdatedPixels, target.size().unclampedArea());
+}
+
+void BitmapTextureJava::updateContents(NativeImage* image, const IntRect& target, const IntPoint& sourceOffset)
+{
+    if (!m_image || !image || target.isEmpty())
+        return;
+
+    GraphicsContext& context = m_image->context();
+    context.clearRect(target);
+    context.drawNativeImage(*image, target, IntRect(sourceOffset, target.size()));
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::CompositingTextureUpdatedPixels, target.size().unclampedArea());
+}
+
+void BitmapTextureJava::updateContents(GraphicsLayer* sourceLayer, const IntRect& target, const IntPoint& sourceOffset, float scale)
+{
+    if (!m_image || target.isEmpty())
+        return;
+
+    // Paint straight into the dirty part of the backing buffer rather than
+    // through an intermediate image of the target size.
+    GraphicsContext& context = m_image->context();
+    GraphicsContextStateSaver stateSaver(context);
+    context.clip(target);
+    context.clearRect(target);
+    context.setTextDrawingMode(TextDrawingMode::Fill);
+
+    IntRect sourceRect(target);
+    sourceRect.setLocation(sourceOffset);
+    sourceRect.scale(1 / scale);
+    context.translate(target.x(), target.y());
+    context.applyDeviceScaleFactor(scale);
+    context.translate(-sourceRect.x(), -sourceRect.y());
+
+    sourceLayer->paintGraphicsLayerContents(context, sourceRect);
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::CompositingTextureUpdatedPixels, target.size().unclampedArea());
 }
 
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,14 +25,16 @@
 
 #pragma once
 
-#include "BitmapTexture.h"
 #include "ImageBuffer.h"
 #include "IntRect.h"
 #include "IntSize.h"
+#include "PixelFormat.h"
 
 namespace WebCore {
 
 class GraphicsContext;
+class GraphicsLayer;
+class NativeImage;
 
 class BitmapTextureJava : public ThreadSafeRefCounted<BitmapTextureJava> {
 public:
@@ -44,12 +46,13 @@ public:
 
     typedef unsigned Flags;
     static Ref<BitmapTextureJava> create() { return adoptRef(*new BitmapTextureJava); }
-    IntSize size() const { return m_image->backendSize(); }
+    IntSize size() const { return m_image ? m_image->backendSize() : IntSize(); }
     void didReset();
     bool isValid() const { return m_image.get(); }
     inline GraphicsContext* graphicsContext() { return m_image ? &(m_image->context()) : nullptr; }
     void updateContents(NativeImage*, const IntRect&, const IntPoint&);
-    void updateContents(const void*, const IntRect& target, const IntPoint& sourceOffset, int bytesPerLine);
+    void updateContents(const void*, const IntRect& target, const IntPoint& sourceOffset, int bytesPerLine, PixelFormat);
+    void updateContents(GraphicsLayer*, const IntRect& target, const IntPoint& sourceOffset, float scale);
     ImageBuffer* image() const { return m_image.get(); }
     void reset(const IntSize& size, Flags flags = 0)
     {
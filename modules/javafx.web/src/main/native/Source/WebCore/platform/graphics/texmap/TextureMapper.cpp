@@ -32,6 +32,8 @@
 #include "FloatRoundedRect.h"
 #if !PLATFORM(JAVA)
 #include "GLContext.h"
+#else
+#include "TextureMapperJava.h"
 #endif
 #include "GraphicsContext.h"
 #include "GraphicsTypesGL.h"
@@ -122,6 +124,8 @@ private:
         {
         #if !PLATFORM(JAVA)
             glGetIntegerv(GL_MAX_TEXTURE_SIZE, &m_maxTextureSize);
+        #else
+            m_maxTextureSize = 0;
         #endif
         }
 
@@ -229,6 +233,8 @@ std::unique_ptr<TextureMapper> TextureMapper::create()
 TextureMapper::TextureMapper()
 #if !PLATFORM(JAVA)
     : m_data(new TextureMapperGLData(GLContext::current()->platformContext()))
+#else
+    : m_data(new TextureMapperGLData(this))
 #endif
 {
 }
@@ -275,6 +281,11 @@ void TextureMapper::beginPainting(FlipY flipY, BitmapTexture* surface)
     glGetIntegerv(GL_FRAMEBUFFER_BINDING, &data().targetFrameBuffer);
     data().flipY = flipY;
     bindSurface(surface);
+#else
+    GraphicsContext* context = m_javaMapper ? m_javaMapper->graphicsContext() : nullptr;
+    m_clipStack.reset(context ? context->clipBounds() : IntRect(), ClipStack::YAxisMode::Default);
+    data().flipY = flipY;
+    bindSurface(surface);
 #endif
 }
 
@@ -528,6 +539,12 @@ void TextureMapper::drawTexture(const BitmapTexture& texture, const FloatRect& t
     SetForScope filterOperation(data().filterOperation, texture.filterOperation());
 
     drawTexture(texture.id(), texture.colorConvertFlags() | (texture.isOpaque() ? OptionSet<TextureMapperFlags> { } : TextureMapperFlags::ShouldBlend), targetRect, matrix, opacity, allEdgesExposed);
+#else
+    UNUSED_PARAM(allEdgesExposed);
+    if (!m_javaMapper || clipStack().isCurrentScissorBoxEmpty())
+        return;
+
+    m_javaMapper->drawTexture(texture.javaTexture(), targetRect, matrix, opacity, 0);
 #endif
 }
 
@@ -562,6 +579,10 @@ void TextureMapper::drawTextureFragment(const BitmapTexture& sourceTexture, cons
     glUniform1i(program->samplerLocation(), 0);
 
     draw(targetRect, TransformationMatrix(), program.get(), GL_TRIANGLE_FAN, { });
+#else
+    UNUSED_PARAM(sourceTexture);
+    UNUSED_PARAM(sourceRect);
+    UNUSED_PARAM(targetRect);
 #endif
 }
 #endif
@@ -822,6 +843,9 @@ void TextureMapper::drawSolidColor(const FloatRect& rect, const TransformationMa
         flags.add(TextureMapperFlags::ShouldBlend);
 
     draw(rect, matrix, program.get(), GL_TRIANGLE_FAN, flags);
+#else
+    if (m_javaMapper)
+        m_javaMapper->drawSolidColor(rect, matrix, color, isBlendingAllowed);
 #endif
 }
 
@@ -1338,6 +1362,10 @@ void TextureMapper::bindDefaultSurface()
     m_clipStack.apply();
     data().currentSurface = nullptr;
     updateProjectionMatrix();
+#else
+    data().currentSurface = nullptr;
+    if (m_javaMapper)
+        m_javaMapper->bindSurface(nullptr);
 #endif
 }
 
@@ -1351,6 +1379,10 @@ void TextureMapper::bindSurface(BitmapTexture *surface)
     surface->bindAsSurface();
     data().currentSurface = surface;
     updateProjectionMatrix();
+#if PLATFORM(JAVA)
+    if (m_javaMapper)
+        m_javaMapper->bindSurface(&surface->javaTexture());
+#endif
 }
 
 BitmapTexture* TextureMapper::currentSurface()
@@ -1461,6 +1493,11 @@ void TextureMapper::beginClip(const TransformationMatrix& modelViewMatrix, const
     // Increase stencilIndex and apply stencil testing.
     clipStack().setStencilIndex(stencilIndex * 2);
     clipStack().applyIfNeeded();
+#else
+    clipStack().push();
+    clipStack().intersect(modelViewMatrix.projectQuad(targetRect.rect()).enclosingBoundingBox());
+    if (m_javaMapper)
+        m_javaMapper->beginClip(modelViewMatrix, targetRect);
 #endif
 }
 
@@ -1524,6 +1561,9 @@ void TextureMapper::beginClip(const TransformationMatrix& modelViewMatrix, const
     // Increase stencilIndex and apply stencil testing.
     clipStack().setStencilIndex(stencilIndex * 2);
     clipStack().applyIfNeeded();
+#else
+    // Clip to the bounds of the path, the Java port has no stencil buffer.
+    beginClip(modelViewMatrix, FloatRoundedRect(clipPath.bounds()));
 #endif
 }
 
@@ -1537,6 +1577,10 @@ void TextureMapper::endClip()
 {
     clipStack().pop();
     clipStack().applyIfNeeded();
+#if PLATFORM(JAVA)
+    if (m_javaMapper)
+        m_javaMapper->endClip();
+#endif
 }
 
 void TextureMapper::endClipWithoutApplying()
@@ -1551,6 +1595,10 @@ IntRect TextureMapper::clipBounds()
 
 IntSize TextureMapper::maxTextureSize() const
 {
+#if PLATFORM(JAVA)
+    if (m_javaMapper)
+        return m_javaMapper->maxTextureSize();
+#endif
     return IntSize(data().maxTextureSize(), data().maxTextureSize());
 }
 
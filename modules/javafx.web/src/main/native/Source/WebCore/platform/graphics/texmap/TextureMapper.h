@@ -45,6 +45,9 @@ namespace WebCore {
 
 class ClipPath;
 class TextureMapperGLData;
+#if PLATFORM(JAVA)
+class TextureMapperJava;
+#endif
 class TextureMapperGPUBuffer;
 class TextureMapperShaderProgram;
 class FilterOperations;
@@ -123,6 +126,11 @@ public:
     const std::optional<Damage>& damage() const { return m_damage; }
 #endif
 
+#if PLATFORM(JAVA)
+    // The Java port draws through the GraphicsContext based TextureMapperJava.
+    void setJavaMapper(TextureMapperJava* javaMapper) { m_javaMapper = javaMapper; }
+#endif
+
 private:
     bool isInMaskMode() const { return m_isMaskMode; }
     const TransformationMatrix& patternTransform() const { return m_patternTransform; }
@@ -159,6 +167,9 @@ private:
 #if ENABLE(DAMAGE_TRACKING)
     std::optional<Damage> m_damage;
 #endif
+#if PLATFORM(JAVA)
+    TextureMapperJava* m_javaMapper { nullptr };
+#endif
 };
 
 } // namespace WebCore
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -36,15 +36,22 @@
 #if USE(TEXTURE_MAPPER)
 namespace WebCore {
 
-static const int s_maximumAllowedImageBufferDimension = 256;
+static const int s_minimumTileSize = 64;
+static const int s_maximumTileSize = 4096;
+static int s_tileSize = 512;
 
 TextureMapperJava::TextureMapperJava()
 {
 }
 
+void TextureMapperJava::setTileSize(int tileSize)
+{
+    s_tileSize = std::clamp(tileSize, s_minimumTileSize, s_maximumTileSize);
+}
+
 IntSize TextureMapperJava::maxTextureSize() const
 {
-    return IntSize(s_maximumAllowedImageBufferDimension, s_maximumAllowedImageBufferDimension);
+    return IntSize(s_tileSize, s_tileSize);
 }
 
 void TextureMapperJava::beginClip(const TransformationMatrix& matrix, const FloatRoundedRect& rect)
@@ -55,26 +62,36 @@ void TextureMapperJava::beginClip(const TransformationMatrix& matrix, const Floa
     auto previousTransform = context->getCTM();
     context->save();
     context->concatCTM(matrix.toAffineTransform());
-    context->clip(rect.rect());
+    if (rect.isRounded())
+        context->clipRoundedRect(rect);
+    else
+        context->clip(rect.rect());
     context->setCTM(previousTransform);
 }
 
+static void setPerspectiveTransform(GraphicsContext& context, const TransformationMatrix& transform)
+{
+    context.platformContext()->rq().putState(RenderingQueue::StateSlot::PerspectiveTransform,
+        com_sun_webkit_graphics_GraphicsDecoder_SET_PERSPECTIVE_TRANSFORM,
+        (float)transform.m11(), (float)transform.m12(), (float)transform.m13(), (float)transform.m14(),
+        (float)transform.m21(), (float)transform.m22(), (float)transform.m23(), (float)transform.m24(),
+        (float)transform.m31(), (float)transform.m32(), (float)transform.m33(), (float)transform.m34(),
+        (float)transform.m41(), (float)transform.m42(), (float)transform.m43(), (float)transform.m44());
+}
+
 void TextureMapperJava::drawTexture(const BitmapTextureJava& texture, const FloatRect& targetRect, const TransformationMatrix& transform, float opacity, unsigned /* exposedEdges */)
 {
     GraphicsContext* context = currentContext();
     if (!context)
         return;
 
-    const BitmapTextureJava& textureImageBuffer = texture;
-    ImageBuffer* image = textureImageBuffer.image();
+    ImageBuffer* image = texture.image();
+    if (!image)
+        return;
+
     context->save();
     context->setAlpha(opacity);
-    context->platformContext()->rq().freeSpace(68)
-        << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_PERSPECTIVE_TRANSFORM
-        << (float)transform.m11() << (float)transform.m12() << (float)transform.m13() << (float)transform.m14()
-        << (float)transform.m21() << (float)transform.m22() << (float)transform.m23() << (float)transform.m24()
-        << (float)transform.m31() << (float)transform.m32() << (float)transform.m33() << (float)transform.m34()
-        << (float)transform.m41() << (float)transform.m42() << (float)transform.m43() << (float)transform.m44();
+    setPerspectiveTransform(*context, transform);
     context->drawImageBuffer(*image, targetRect);
     context->restore();
 }
@@ -86,12 +103,7 @@ void TextureMapperJava::drawSolidColor(const FloatRect& rect, const Transformati
         return;
 
     context->save();
-    context->platformContext()->rq().freeSpace(68)
-        << (jint)com_sun_webkit_graphics_GraphicsDecoder_SET_PERSPECTIVE_TRANSFORM
-        << (float)transform.m11() << (float)transform.m12() << (float)transform.m13() << (float)transform.m14()
-        << (float)transform.m21() << (float)transform.m22() << (float)transform.m23() << (float)transform.m24()
-        << (float)transform.m31() << (float)transform.m32() << (float)transform.m33() << (float)transform.m34()
-        << (float)transform.m41() << (float)transform.m42() << (float)transform.m43() << (float)transform.m44();
+    setPerspectiveTransform(*context, transform);
 
     context->fillRect(rect, color);
     context->restore();
@@ -7,7 +7,10 @@ namespace WebCore {
 class TextureMapperJavaAdapter final : public TextureMapper {
 public:
     TextureMapperJavaAdapter()
-        :  m_javaMapper(TextureMapperJava::create()) { }
+        :  m_javaMapper(TextureMapperJava::create())
+    {
+        setJavaMapper(m_javaMapper.ptr());
+    }
 
     TextureMapperJava& javaMapper() { return m_javaMapper.get(); }
 
@@ -449,8 +449,14 @@ void TextureMapperLayer::collectDamageSelfAndChildren(TextureMapperPaintOptions&
     for (auto* child : m_children)
         child->collectDamageRecursive(options, damage);
 
-    if (shouldClip)
+    if (shouldClip) {
+#if PLATFORM(JAVA)
+        // The clip was never applied, so don't unwind the GraphicsContext state.
+        options.textureMapper.endClipWithoutApplying();
+#else
         options.textureMapper.endClip();
+#endif
+    }
 }
 
 static FloatRect transformRectFromLayerToGlobalCoordinateSpace(const FloatRect& rect, const TransformationMatrix& transform, const TextureMapperPaintOptions& options)
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "ImageBackingStore.h"
+
+#include "ImageJava.h"
+#include "PlatformJavaClasses.h"
+#include "RQRef.h"
+#include <wtf/Vector.h>
+
+namespace WebCore {
+
+// The decoded BGRA pixels are passed to the graphics manager in a single call as a
+// direct buffer; the Java side copies them into a premultiplied INT_ARGB_PRE image.
+PlatformImagePtr ImageBackingStore::image() const
+{
+    // Frames decoded for DecodingMode::Asynchronous are created on the
+    // ImageFrameWorkQueue thread, which may not be attached to the VM yet.
+    JNIEnv* env = WTF::GetJavaEnvAttachingThread();
+    if (!env)
+        return nullptr;
+
+    static jmethodID midCreateFrame = env->GetMethodID(
+        PG_GetGraphicsManagerClass(env),
+        "createFrame",
+        "(IILjava/nio/ByteBuffer;)Lcom/sun/webkit/graphics/WCImageFrame;");
+    ASSERT(midCreateFrame);
+
+    // Java images are always premultiplied, so unpremultiplied frames are converted on a copy.
+    Vector<uint32_t> premultipliedPixels;
+    auto pixels = m_pixelsSpan;
+    if (!m_premultiplyAlpha) {
+        premultipliedPixels = WTF::map(m_pixelsSpan, [](uint32_t pixel) {
+            return PackedColor::ARGB { premultipliedFlooring(asSRGBA(PackedColor::ARGB { pixel })) }.value;
+        });
+        pixels = premultipliedPixels.mutableSpan();
+    }
+
+    auto bytes = asWritableBytes(pixels);
+    JLObject data(env->NewDirectByteBuffer(bytes.data(), bytes.size()));
+    if (!data) {
+        WTF::CheckAndClearException(env);
+        return nullptr;
+    }
+
+    JLObject frame(env->CallObjectMethod(
+        PL_GetGraphicsManager(env),
+        midCreateFrame,
+        m_size.width(),
+        m_size.height(),
+        (jobject)data));
+    if (WTF::CheckAndClearException(env) || !frame)
+        return nullptr;
+
+    return ImageJava::create(RQRef::create(frame), nullptr, m_size.width(), m_size.height());
+}
+
+} // namespace WebCore
@@ -594,6 +594,27 @@ bool JPEGImageDecoder::setFailed()
     return ScalableImageDecoder::setFailed();
 }
 
+#if PLATFORM(JAVA)
+bool JPEGImageDecoder::setSize(const IntSize& size)
+{
+    // Decoding a frame dropped by clearFrameBufferCache() reads the header again;
+    // that must not take the encoded data status back to SizeAvailable.
+    if (isAllDataReceived() && size == this->size())
+        return true;
+    return ScalableImageDecoder::setSize(size);
+}
+
+void JPEGImageDecoder::clearFrameBufferCache(size_t)
+{
+    // The Java image created from the frame holds its own copy of the pixels,
+    // so a complete frame can be released and decoded again from m_data.
+    Locker locker { m_lock };
+    if (m_frameBufferCache.isEmpty() || !m_frameBufferCache[0].isComplete() || !isAllDataReceived())
+        return;
+    m_frameBufferCache[0].clear();
+}
+#endif
+
 template <J_COLOR_SPACE colorSpace>
 void setPixel(ScalableImageDecoderFrame& buffer, std::span<uint32_t> currentAddress, JSAMPARRAY samples, int column)
 {
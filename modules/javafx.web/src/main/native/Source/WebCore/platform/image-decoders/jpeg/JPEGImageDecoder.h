@@ -62,6 +62,10 @@ namespace WebCore {
         // accessing deleted memory, especially when calling this from inside
         // JPEGImageReader!
         bool setFailed() override;
+#if PLATFORM(JAVA)
+        bool setSize(const IntSize&) override;
+        void clearFrameBufferCache(size_t) override;
+#endif
 
         bool outputScanlines();
         void jpegComplete();
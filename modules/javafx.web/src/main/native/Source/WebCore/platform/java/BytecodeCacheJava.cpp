@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+#include "BytecodeCacheJava.h"
+
+#include <JavaScriptCore/BytecodeCacheError.h>
+#include <JavaScriptCore/CachedTypes.h>
+#include <JavaScriptCore/SourceProvider.h>
+#include <JavaScriptCore/UnlinkedFunctionExecutable.h>
+#include <algorithm>
+#include <wtf/CryptographicallyRandomNumber.h>
+#include <wtf/FileHandle.h>
+#include <wtf/FileSystem.h>
+#include <wtf/HexNumber.h>
+#include <wtf/MainThread.h>
+#include <wtf/MonotonicTime.h>
+#include <wtf/MappedFileData.h>
+#include <wtf/NeverDestroyed.h>
+#include <wtf/SHA1.h>
+#include <wtf/WallTime.h>
+#include <wtf/java/PerfCounters.h>
+#include <wtf/text/MakeString.h>
+
+namespace WebCore {
+
+namespace {
+
+uint64_t maxCacheSize;
+
+// The size of the cache as of the last prune, plus what was written since
+uint64_t estimatedCacheSize;
+MonotonicTime lastPruneTime;
+
+// Entries not written for this long are deleted
+constexpr Seconds maxEntryAge = Seconds::fromHours(30 * 24);
+
+// Listing the directory takes a JNI call per entry, so the cache is only
+// pruned this often unless it grows past its size limit.
+constexpr Seconds pruneInterval = 10_min;
+
+// Entry names are <SHA1 of the URL>-<SHA1 of the source>-<source type>.bytecode-cache
+constexpr unsigned urlHashLength = 41;
+constexpr unsigned sourceHashLength = 41;
+constexpr auto entrySuffix = ".bytecode-cache"_s;
+constexpr auto temporarySuffix = ".tmp"_s;
+
+String& cacheDirectory()
+{
+    static NeverDestroyed<String> directory;
+    return directory;
+}
+
+// Whether the entry is for the same URL and source type as the current one,
+// but for another version of the source.
+bool isSupersededBy(StringView name, StringView current)
+{
+    if (current.isEmpty() || name == current || name.length() != current.length())
+        return false;
+    return name.left(urlHashLength) == current.left(urlHashLength)
+        && name.substring(urlHashLength + sourceHashLength) == current.substring(urlHashLength + sourceHashLength);
+}
+
+// Deletes the stale entries and then, while the cache is over its size
+// limit, the least recently written ones.
+void pruneCache(const String& currentName)
+{
+    struct Entry {
+        String path;
+        WallTime modificationTime;
+        uint64_t size;
+    };
+
+    lastPruneTime = MonotonicTime::now();
+
+    Vector<Entry> entries;
+    uint64_t totalSize = 0;
+    WallTime expiry = WallTime::now() - maxEntryAge;
+    for (auto& name : FileSystem::listDirectory(cacheDirectory())) {
+        bool isTemporary = name.endsWith(temporarySuffix);
+        if (!isTemporary && !name.endsWith(entrySuffix))
+            continue;
+        String path = FileSystem::pathByAppendingComponent(cacheDirectory(), name);
+        auto modificationTime = FileSystem::fileModificationTime(path);
+        if (!modificationTime)
+            continue;
+        // Temporary files are only left behind by a commit that never
+        // finished, but may belong to one in progress elsewhere.
+        if (isTemporary) {
+            if (*modificationTime < expiry)
+                FileSystem::deleteFile(path);
+            continue;
+        }
+        if (name != currentName && (*modificationTime < expiry || isSupersededBy(name, currentName))) {
+            FileSystem::deleteFile(path);
+            continue;
+        }
+        uint64_t size = FileSystem::fileSize(path).value_or(0);
+        totalSize += size;
+        entries.append({ WTFMove(path), *modificationTime, size });
+    }
+
+    estimatedCacheSize = totalSize;
+    if (totalSize <= maxCacheSize)
+        return;
+
+    std::ranges::sort(entries, [](auto& a, auto& b) {
+        return a.modificationTime < b.modificationTime;
+    });
+    for (auto& entry : entries) {
+        if (totalSize <= maxCacheSize)
+            break;
+        if (FileSystem::deleteFile(entry.path))
+            totalSize -= entry.size;
+    }
+    estimatedCacheSize = totalSize;
+}
+
+String cachePath(const JSC::SourceProvider& provider)
+{
+    const URL& url = provider.sourceOrigin().url();
+    if (cacheDirectory().isEmpty() || url.isEmpty() || url.protocolIsData())
+        return { };
+
+    // The source is keyed on its digest rather than on provider.hash(),
+    // as a collision would hand a script the bytecode of another one.
+    auto sha1HexDigest = [](StringView string) {
+        SHA1 sha1;
+        sha1.addUTF8Bytes(string);
+        SHA1::Digest digest;
+        sha1.computeHash(digest);
+        return String::fromLatin1(SHA1::hexDigest(digest).data());
+    };
+
+    return FileSystem::pathByAppendingComponent(cacheDirectory(),
+        makeString(sha1HexDigest(url.string()), '-', sha1HexDigest(provider.source()), '-', static_cast<unsigned>(provider.sourceType()), entrySuffix));
+}
+
+// Writes the bytecode the updates were made against followed by the updates
+// to a new file, so that the pages that have the current one mapped never
+// see it change.
+bool writeCachedBytecode(const String& path, const JSC::CachedBytecode& cachedBytecode)
+{
+    auto handle = FileSystem::openFile(path, FileSystem::FileOpenMode::Truncate, FileSystem::FileAccessPermission::User, { }, true);
+    if (!handle)
+        return false;
+
+    auto payload = cachedBytecode.span();
+    if (handle.write(payload) != payload.size() || !handle.truncate(cachedBytecode.sizeForUpdate()))
+        return false;
+
+    bool succeeded = true;
+    cachedBytecode.commitUpdates([&] (off_t offset, std::span<const uint8_t> data) {
+        if (!succeeded)
+            return;
+        succeeded = handle.seek(offset, FileSystem::FileSeekOrigin::Beginning)
+            && handle.write(data) == data.size();
+    });
+    return succeeded;
+}
+
+} // namespace
+
+void BytecodeCacheJava::setDirectory(const String& directory, uint64_t maxSize)
+{
+    ASSERT(isMainThread());
+    if (!directory.isEmpty() && !FileSystem::makeAllDirectories(directory)) {
+        cacheDirectory() = String();
+        return;
+    }
+    cacheDirectory() = directory;
+    maxCacheSize = maxSize;
+    if (!directory.isEmpty())
+        pruneCache({ });
+}
+
+bool BytecodeCacheJava::isEnabled()
+{
+    return !cacheDirectory().isEmpty();
+}
+
+RefPtr<JSC::CachedBytecode> BytecodeCacheJava::load(const JSC::SourceProvider& provider)
+{
+    String path = cachePath(provider);
+    if (path.isNull())
+        return nullptr;
+
+    // A commit holds the exclusive lock while it replaces the entry
+    if (auto handle = FileSystem::openFile(path, FileSystem::FileOpenMode::Read, FileSystem::FileAccessPermission::User, { FileSystem::FileLockMode::Shared, FileSystem::FileLockMode::Nonblocking })) {
+        auto mappedFileData = handle.map(FileSystem::MappedFileMode::Private);
+        if (mappedFileData && mappedFileData->size()) {
+            WTF::PerfCounters::add(WTF::PerfCounters::Counter::BytecodeCacheHits);
+            return JSC::CachedBytecode::create(WTFMove(*mappedFileData));
+        }
+    }
+
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::BytecodeCacheMisses);
+    return nullptr;
+}
+
+void BytecodeCacheJava::addFunctionUpdate(JSC::CachedBytecode& cachedBytecode, const JSC::UnlinkedFunctionExecutable* executable, JSC::CodeSpecializationKind kind, const JSC::UnlinkedFunctionCodeBlock* codeBlock)
+{
+    if (!isEnabled())
+        return;
+
+    JSC::BytecodeCacheError error;
+    RefPtr<JSC::CachedBytecode> update = JSC::encodeFunctionCodeBlock(executable->vm(), codeBlock, error);
+    if (update && !error.isValid())
+        cachedBytecode.addFunctionUpdate(executable, kind, *update);
+}
+
+void BytecodeCacheJava::commit(const JSC::SourceProvider& provider, const JSC::CachedBytecode& cachedBytecode)
+{
+    if (!cachedBytecode.hasUpdates())
+        return;
+
+    String path = cachePath(provider);
+    if (path.isNull())
+        return;
+
+    // The entry is only replaced if it still holds the bytecode the updates
+    // were made against, and no other page is replacing it; otherwise
+    // another page got to it first.
+    FileSystem::FileHandle handle;
+    if (cachedBytecode.size()) {
+        handle = FileSystem::openFile(path, FileSystem::FileOpenMode::Read, FileSystem::FileAccessPermission::User, { FileSystem::FileLockMode::Exclusive, FileSystem::FileLockMode::Nonblocking });
+        if (!handle)
+            return;
+        auto fileSize = handle.size();
+        if (!fileSize || *fileSize != cachedBytecode.size())
+            return;
+    } else if (FileSystem::fileExists(path))
+        return;
+
+    String temporaryPath = makeString(path, '-', hex(cryptographicallyRandomNumber<uint32_t>(), 8), temporarySuffix);
+    if (!writeCachedBytecode(temporaryPath, cachedBytecode) || !FileSystem::moveFile(temporaryPath, path)) {
+        FileSystem::deleteFile(temporaryPath);
+        return;
+    }
+    // Releases the lock
+    handle = { };
+
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::BytecodeCacheCommits);
+    estimatedCacheSize += cachedBytecode.sizeForUpdate() - cachedBytecode.size();
+    if (estimatedCacheSize > maxCacheSize || MonotonicTime::now() - lastPruneTime >= pruneInterval)
+        pruneCache(FileSystem::pathFileName(path));
+}
+
+} // namespace WebCore
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#pragma once
+
+#include <JavaScriptCore/CachedBytecode.h>
+#include <JavaScriptCore/CodeSpecializationKind.h>
+#include <wtf/Forward.h>
+
+namespace JSC {
+class SourceProvider;
+class UnlinkedFunctionCodeBlock;
+class UnlinkedFunctionExecutable;
+}
+
+namespace WebCore {
+
+// An opt-in on-disk cache of the bytecode JavaScriptCore generates for
+// external scripts. Entries are keyed by the script URL, source digest and
+// source type, and are replaced as a whole rather than updated in place. The
+// entries a newer version of a script replaces, the ones not written for a
+// while and, past the size limit, the oldest ones are deleted.
+class BytecodeCacheJava {
+public:
+    // Enables the cache in the given directory, holding at most maxSize
+    // bytes, or disables it when the directory is empty.
+    WEBCORE_EXPORT static void setDirectory(const String&, uint64_t maxSize);
+    static bool isEnabled();
+
+    static RefPtr<JSC::CachedBytecode> load(const JSC::SourceProvider&);
+    static void addFunctionUpdate(JSC::CachedBytecode&, const JSC::UnlinkedFunctionExecutable*, JSC::CodeSpecializationKind, const JSC::UnlinkedFunctionCodeBlock*);
+    static void commit(const JSC::SourceProvider&, const JSC::CachedBytecode&);
+};
+
+} // namespace WebCore
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "config.h"
+
+#include <pal/crypto/CryptoDigest.h>
+#include <wtf/java/JavaEnv.h>
+#include <wtf/text/WTFString.h>
+
+#include "com_sun_webkit_CryptoDigest.h"
+
+namespace WebCore {
+
+extern "C" {
+
+JNIEXPORT jlong JNICALL Java_com_sun_webkit_CryptoDigest_twkCreate
+  (JNIEnv* env, jclass, jstring algorithm)
+{
+    String name(env, algorithm);
+    PAL::CryptoDigest::Algorithm digestAlgorithm;
+    if (name == "SHA-1"_s)
+        digestAlgorithm = PAL::CryptoDigest::Algorithm::SHA_1;
+    else if (name == "SHA-224"_s)
+        digestAlgorithm = PAL::CryptoDigest::Algorithm::DEPRECATED_SHA_224;
+    else if (name == "SHA-256"_s)
+        digestAlgorithm = PAL::CryptoDigest::Algorithm::SHA_256;
+    else if (name == "SHA-384"_s)
+        digestAlgorithm = PAL::CryptoDigest::Algorithm::SHA_384;
+    else if (name == "SHA-512"_s)
+        digestAlgorithm = PAL::CryptoDigest::Algorithm::SHA_512;
+    else
+        return 0;
+    return ptr_to_jlong(PAL::CryptoDigest::create(digestAlgorithm).release());
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_CryptoDigest_twkAddBytes
+  (JNIEnv* env, jclass, jlong nativePointer, jbyteArray buffer,
+   jint offset, jint length)
+{
+    PAL::CryptoDigest* p = static_cast<PAL::CryptoDigest*>(jlong_to_ptr(nativePointer));
+    ASSERT(p);
+    ASSERT(buffer);
+    ASSERT(offset >= 0);
+    ASSERT(length >= 0);
+
+    uint8_t* bufferBody = static_cast<uint8_t*>(
+            env->GetPrimitiveArrayCritical(buffer, NULL));
+    p->addBytes(std::span<const uint8_t>(bufferBody + offset, length));
+    env->ReleasePrimitiveArrayCritical(buffer, bufferBody, JNI_ABORT);
+}
+
+JNIEXPORT jbyteArray JNICALL Java_com_sun_webkit_CryptoDigest_twkComputeHash
+  (JNIEnv* env, jclass, jlong nativePointer)
+{
+    PAL::CryptoDigest* p = static_cast<PAL::CryptoDigest*>(jlong_to_ptr(nativePointer));
+    ASSERT(p);
+
+    Vector<uint8_t> hash = p->computeHash();
+    jbyteArray result = env->NewByteArray(hash.size());
+    if (!result)
+        return nullptr;
+    env->SetByteArrayRegion(result, 0, hash.size(), reinterpret_cast<const jbyte*>(hash.data()));
+    return result;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_CryptoDigest_twkDispose
+  (JNIEnv*, jclass, jlong nativePointer)
+{
+    delete static_cast<PAL::CryptoDigest*>(jlong_to_ptr(nativePointer));
+}
+
+}
+}   // namespace WebCore
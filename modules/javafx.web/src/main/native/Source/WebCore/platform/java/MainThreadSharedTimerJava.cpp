@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -48,6 +48,7 @@ void MainThreadSharedTimer::setFireInterval(Seconds timeout)
                                                   "fwkSetFireTime", "(D)V");
     ASSERT(mid);
 
+    LOG_PERF_RECORD("Timer", "fwkSetFireTime");
     env->CallStaticVoidMethod(getTimerClass(env), mid, fireTime);
     WTF::CheckAndClearException(env);
 }
@@ -60,6 +61,7 @@ void MainThreadSharedTimer::stop()
                                                   "fwkStopTimer", "()V");
     ASSERT(mid);
 
+    LOG_PERF_RECORD("Timer", "fwkStopTimer");
     env->CallStaticVoidMethod(getTimerClass(env), mid);
     WTF::CheckAndClearException(env);
 }
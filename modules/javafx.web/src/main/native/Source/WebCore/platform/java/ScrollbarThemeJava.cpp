@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -110,6 +110,7 @@ IntRect getPartRect(Scrollbar& scrollbar, ScrollbarPart part) {
     JLocalRef<jintArray> jrect(env->NewIntArray(4));
     WTF::CheckAndClearException(env); // OOME
     ASSERT(jrect);
+    LOG_PERF_RECORD("ScrollBarTheme", "getScrollBarPartRect");
     env->CallVoidMethod(jtheme,
             midGetPartRect,
             ptr_to_jlong(&scrollbar),
@@ -160,6 +161,7 @@ bool ScrollbarThemeJava::paint(Scrollbar& scrollbar, GraphicsContext& gc, const
         "(JIIIIII)Lcom/sun/webkit/graphics/Ref;");
     ASSERT(mid);
 
+    LOG_PERF_RECORD("ScrollBarTheme", "createWidget");
     RefPtr<RQRef> widgetRef = RQRef::create( env->CallObjectMethod(
         jtheme,
         mid,
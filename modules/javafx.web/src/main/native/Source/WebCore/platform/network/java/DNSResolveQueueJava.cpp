@@ -28,28 +28,211 @@
 
 #if PLATFORM(JAVA)
 
-#include "NotImplemented.h"
+#include "PlatformJavaClasses.h"
+#include <wtf/CompletionHandler.h>
+#include <wtf/MainThread.h>
+#include <wtf/Threading.h>
+#include <wtf/java/PerfCounters.h>
+#include <wtf/text/CString.h>
+
+#if !OS(WINDOWS)
+#include <netdb.h>
+#include <sys/socket.h>
+#endif
 
 namespace WebCore {
 
+// Keep resolved names as long as java.net.InetAddress does by default, and
+// failures as long as its negative cache does.
+static constexpr Seconds positiveCacheTTL { 30_s };
+static constexpr Seconds negativeCacheTTL { 10_s };
+static constexpr unsigned maxCacheSize = 256;
+
+static constexpr unsigned maxWorkerCount = 4;
+static constexpr Seconds workerIdleTimeout { 10_s };
+
+static std::optional<Vector<IPAddress>> lookUpHost(const String& hostname)
+{
+    struct addrinfo hints { };
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_ADDRCONFIG;
+
+    struct addrinfo* result = nullptr;
+    if (getaddrinfo(hostname.utf8().data(), nullptr, &hints, &result) || !result)
+        return std::nullopt;
+
+    Vector<IPAddress> addresses;
+    for (auto* info = result; info; info = info->ai_next) {
+        if (info->ai_family == AF_INET)
+            addresses.append(IPAddress { reinterpret_cast<struct sockaddr_in*>(info->ai_addr)->sin_addr });
+        else if (info->ai_family == AF_INET6)
+            addresses.append(IPAddress { reinterpret_cast<struct sockaddr_in6*>(info->ai_addr)->sin6_addr });
+    }
+    freeaddrinfo(result);
+
+    if (addresses.isEmpty())
+        return std::nullopt;
+    return addresses;
+}
+
 void DNSResolveQueueJava::updateIsUsingProxy()
 {
-    notImplemented();
+    JNIEnv* env = WTF::GetJavaEnv();
+    if (!env)
+        return;
+
+    static JGClass networkContextClass = JLClass(env->FindClass("com/sun/webkit/network/NetworkContext"));
+    ASSERT(networkContextClass);
+    static jmethodID isUsingProxyMID = env->GetStaticMethodID(networkContextClass, "fwkIsUsingProxy", "()Z");
+    ASSERT(isUsingProxyMID);
+
+    jboolean isUsingProxy = env->CallStaticBooleanMethod(networkContextClass, isUsingProxyMID);
+    if (WTF::CheckAndClearException(env))
+        m_isUsingProxy = true;
+    else
+        m_isUsingProxy = jbool_to_bool(isUsingProxy);
+}
+
+const DNSResolveQueueJava::CacheEntry* DNSResolveQueueJava::cachedEntry(const String& hostname)
+{
+    auto it = m_cache.find(hostname);
+    if (it == m_cache.end())
+        return nullptr;
+    if (it->value.expirationTime <= MonotonicTime::now()) {
+        m_cache.remove(it);
+        return nullptr;
+    }
+    return &it->value;
+}
+
+void DNSResolveQueueJava::addToCache(const String& hostname, std::optional<Vector<IPAddress>>&& addresses)
+{
+    auto now = MonotonicTime::now();
+    if (m_cache.size() >= maxCacheSize && !m_cache.contains(hostname)) {
+        m_cache.removeIf([now](auto& entry) {
+            return entry.value.expirationTime <= now;
+        });
+        if (m_cache.size() >= maxCacheSize)
+            m_cache.remove(m_cache.begin());
+    }
+
+    auto expirationTime = now + (addresses ? positiveCacheTTL : negativeCacheTTL);
+    m_cache.set(hostname, CacheEntry { WTFMove(addresses), expirationTime });
+}
+
+DNSResolveQueueJava::PendingLookup& DNSResolveQueueJava::startLookup(const String& hostname)
+{
+    auto result = m_pendingLookups.add(hostname, PendingLookup { });
+    if (!result.isNewEntry)
+        return result.iterator->value;
+
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::DNSPrefetchLookups);
+
+    Locker locker { m_queueLock };
+    m_queue.append(hostname.isolatedCopy());
+    if (m_idleWorkerCount) {
+        m_queueCondition.notifyOne();
+    } else if (m_workerCount < maxWorkerCount) {
+        ++m_workerCount;
+        Thread::create("DNS Resolver"_s, [this] {
+            runWorker();
+        })->detach();
+    }
+    return result.iterator->value;
+}
+
+void DNSResolveQueueJava::runWorker()
+{
+    while (true) {
+        String hostname;
+        {
+            Locker locker { m_queueLock };
+            if (m_queue.isEmpty()) {
+                ++m_idleWorkerCount;
+                m_queueCondition.waitFor(m_queueLock, workerIdleTimeout, [this]() WTF_REQUIRES_LOCK(m_queueLock) {
+                    return !m_queue.isEmpty();
+                });
+                --m_idleWorkerCount;
+                if (m_queue.isEmpty()) {
+                    --m_workerCount;
+                    return;
+                }
+            }
+            hostname = m_queue.takeFirst();
+        }
+
+        auto addresses = lookUpHost(hostname);
+        callOnMainThread([hostname = WTFMove(hostname), addresses = WTFMove(addresses)]() mutable {
+            static_cast<DNSResolveQueueJava&>(DNSResolveQueue::singleton()).didLookUp(hostname, WTFMove(addresses));
+        });
+    }
+}
+
+void DNSResolveQueueJava::didLookUp(const String& hostname, std::optional<Vector<IPAddress>>&& addresses)
+{
+    ASSERT(isMainThread());
+
+    auto lookup = m_pendingLookups.take(hostname);
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::DNSPrefetchCompleted);
+    if (!addresses)
+        WTF::PerfCounters::add(WTF::PerfCounters::Counter::DNSPrefetchFailures);
+
+    for (unsigned i = 0; i < lookup.prefetchCount; ++i)
+        decrementRequestCount();
+
+    for (auto identifier : lookup.identifiers) {
+        if (auto completionHandler = m_completionHandlers.take(identifier)) {
+            if (addresses)
+                completionHandler(Vector<IPAddress> { *addresses });
+            else
+                completionHandler(makeUnexpected(DNSError::CannotResolve));
+        }
+    }
+
+    addToCache(hostname, WTFMove(addresses));
 }
 
-void DNSResolveQueueJava::platformResolve(const String& /* hostname */)
+void DNSResolveQueueJava::platformResolve(const String& hostname)
 {
-    notImplemented();
+    ASSERT(isMainThread());
+
+    if (cachedEntry(hostname)) {
+        WTF::PerfCounters::add(WTF::PerfCounters::Counter::DNSPrefetchHits);
+        decrementRequestCount();
+        return;
+    }
+
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::DNSPrefetchMisses);
+    ++startLookup(hostname).prefetchCount;
 }
 
-void DNSResolveQueueJava::resolve(const String& /* hostname */, uint64_t /* identifier */, DNSCompletionHandler&& /* completionHandler */)
+void DNSResolveQueueJava::resolve(const String& hostname, uint64_t identifier, DNSCompletionHandler&& completionHandler)
 {
-    notImplemented();
+    ASSERT(isMainThread());
+
+    if (auto* entry = cachedEntry(hostname)) {
+        WTF::PerfCounters::add(WTF::PerfCounters::Counter::DNSPrefetchHits);
+        DNSAddressesOrError result = makeUnexpected(DNSError::CannotResolve);
+        if (entry->addresses)
+            result = Vector<IPAddress> { *entry->addresses };
+        callOnMainThread([completionHandler = WTFMove(completionHandler), result = WTFMove(result)]() mutable {
+            completionHandler(WTFMove(result));
+        });
+        return;
+    }
+
+    WTF::PerfCounters::add(WTF::PerfCounters::Counter::DNSPrefetchMisses);
+    m_completionHandlers.set(identifier, WTFMove(completionHandler));
+    startLookup(hostname).identifiers.append(identifier);
 }
 
-void DNSResolveQueueJava::stopResolve(uint64_t /* identifier */)
+void DNSResolveQueueJava::stopResolve(uint64_t identifier)
 {
-    notImplemented();
+    ASSERT(isMainThread());
+
+    if (auto completionHandler = m_completionHandlers.take(identifier))
+        completionHandler(makeUnexpected(DNSError::Cancelled));
 }
 
 }
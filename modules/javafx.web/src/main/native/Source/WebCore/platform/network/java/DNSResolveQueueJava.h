@@ -26,19 +26,53 @@
 #pragma once
 
 #include "DNSResolveQueue.h"
-
+#include <wtf/Condition.h>
+#include <wtf/Deque.h>
+#include <wtf/HashMap.h>
+#include <wtf/Lock.h>
+#include <wtf/MonotonicTime.h>
 
 namespace WebCore {
 
+// Resolves host names with getaddrinfo() on a small pool of worker threads
+// and keeps the results for a short while, so that <link rel=dns-prefetch>
+// and preconnect hints warm the system resolver before the Java networking
+// layer connects to the host.
 class DNSResolveQueueJava final : public DNSResolveQueue {
-
-
 public:
     DNSResolveQueueJava() = default;
     void resolve(const String& hostname, uint64_t identifier, DNSCompletionHandler&&) final;
     void stopResolve(uint64_t identifier) final;
     void updateIsUsingProxy() override;
     void platformResolve(const String&) override;
+
+private:
+    struct CacheEntry {
+        std::optional<Vector<IPAddress>> addresses;
+        MonotonicTime expirationTime;
+    };
+
+    struct PendingLookup {
+        unsigned prefetchCount { 0 };
+        Vector<uint64_t> identifiers;
+    };
+
+    const CacheEntry* cachedEntry(const String& hostname);
+    void addToCache(const String& hostname, std::optional<Vector<IPAddress>>&&);
+    PendingLookup& startLookup(const String& hostname);
+    void didLookUp(const String& hostname, std::optional<Vector<IPAddress>>&&);
+    void runWorker();
+
+    // Only touched on the main thread.
+    HashMap<String, CacheEntry> m_cache;
+    HashMap<String, PendingLookup> m_pendingLookups;
+    HashMap<uint64_t, DNSCompletionHandler> m_completionHandlers;
+
+    Lock m_queueLock;
+    Condition m_queueCondition;
+    Deque<String> m_queue WTF_GUARDED_BY_LOCK(m_queueLock);
+    unsigned m_workerCount WTF_GUARDED_BY_LOCK(m_queueLock) { 0 };
+    unsigned m_idleWorkerCount WTF_GUARDED_BY_LOCK(m_queueLock) { 0 };
 };
 
 using DNSResolveQueuePlatform = DNSResolveQueueJava;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -73,6 +73,7 @@ static String getCookies(const URL& url, bool includeHttpOnlyCookies)
     JNIEnv* env = WTF::GetJavaEnv();
     initRefs(env);
 
+    LOG_PERF_RECORD("CookieJar", "fwkGet");
     JLString result = static_cast<jstring>(env->CallStaticObjectMethod(
             cookieJarClass,
             getMethod,
@@ -99,6 +100,7 @@ void NetworkStorageSession::setCookiesFromDOM(const URL& /*firstParty*/, const S
     JNIEnv* env = WTF::GetJavaEnv();
     initRefs(env);
 
+    LOG_PERF_RECORD("CookieJar", "fwkPut");
     env->CallStaticVoidMethod(
             cookieJarClass,
             putMethod,
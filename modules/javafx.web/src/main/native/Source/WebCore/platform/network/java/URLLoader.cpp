@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -47,6 +47,7 @@
 #include "com_sun_webkit_LoadListenerClient.h"
 #include "com_sun_webkit_network_URLLoaderBase.h"
 #include <wtf/CompletionHandler.h>
+#include <wtf/MallocSpan.h>
 
 namespace WebCore {
 class Page;
@@ -193,6 +194,7 @@ JLObject URLLoader::load(bool asynchronous,
     JNIEnv* env = WTF::GetJavaEnv();
     initRefs(env);
 
+    LOG_PERF_RECORD("NetworkContext", "fwkLoad");
     JLObject loader = env->CallStaticObjectMethod(
             networkContextClass,
             loadMethod,
@@ -498,7 +500,30 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveRe
     target->didReceiveResponse(response);
 }
 
-JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveData
+JNIEXPORT jobject JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkAllocateDataChunk
+  (JNIEnv* env, jclass, jint capacity)
+{
+    ASSERT(capacity > 0);
+    void* chunk;
+    if (!tryFastMalloc(capacity).getValue(chunk))
+        return nullptr;
+    // The chunk is owned by the byte buffer from now on, until it is either
+    // released with twkReleaseDataChunk or adopted by twkDidReceiveData.
+    jobject byteBuffer = env->NewDirectByteBuffer(chunk, capacity);
+    if (!byteBuffer) {
+        WTF::CheckAndClearException(env);
+        fastFree(chunk);
+    }
+    return byteBuffer;
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkReleaseDataChunk
+  (JNIEnv* env, jclass, jobject byteBuffer)
+{
+    fastFree(env->GetDirectBufferAddress(byteBuffer));
+}
+
+JNIEXPORT jboolean JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveData
   (JNIEnv* env, jclass, jobject byteBuffer, jint position, jint remaining,
    jlong data)
 {
@@ -506,11 +531,24 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidReceiveDa
     URLLoader::Target* target =
             static_cast<URLLoader::Target*>(jlong_to_ptr(data));
     ASSERT(target);
-    const uint8_t* address =
-            static_cast<const uint8_t*>(env->GetDirectBufferAddress(byteBuffer));
-    Ref<SharedBuffer> tmp_buf = SharedBuffer::create(std::span<const uint8_t>(address, remaining));
-    target->didReceiveData(tmp_buf->makeContiguous().ptr() + position, remaining);
-    //target->didReceiveData((SharedBuffer*)(address) + position, remaining);
+    uint8_t* address =
+            static_cast<uint8_t*>(env->GetDirectBufferAddress(byteBuffer));
+    jlong capacity = env->GetDirectBufferCapacity(byteBuffer);
+    ASSERT(address && position >= 0 && remaining >= 0 && position + remaining <= capacity);
+
+    // A chunk that is mostly filled is adopted as a SharedBuffer segment,
+    // so the data reaches the resource without being copied. A sparsely
+    // filled one is copied out and stays with the caller for reuse, which
+    // keeps small reads from pinning large chunks in the memory cache.
+    bool adopt = !position && static_cast<jlong>(remaining) * 2 >= capacity;
+    Ref<SharedBuffer> buffer = adopt
+        ? SharedBuffer::create(DataSegment::Provider {
+            [chunk = adoptMallocSpan(std::span<uint8_t>(address, remaining))] {
+                return chunk.span();
+            } })
+        : SharedBuffer::create(std::span<const uint8_t>(address + position, remaining));
+    target->didReceiveData(buffer.ptr(), remaining);
+    return bool_to_jbool(adopt);
 }
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_network_URLLoaderBase_twkDidFinishLoading
@@ -29,6 +29,7 @@
 #include "PingHandle.h"
 #include <WebCore/ArchiveResource.h>
 #include <WebCore/CachedResource.h>
+#include <WebCore/DNS.h>
 #include <WebCore/Document.h>
 #include <WebCore/DocumentLoader.h>
 #include <WebCore/FetchOptions.h>
@@ -417,9 +418,18 @@ void WebResourceLoadScheduler::addOnlineStateChangeListener(WTF::Function<void(b
     NetworkStateNotifier::singleton().addListener(WTFMove(listener));
 }
 
+#if PLATFORM(JAVA)
+void WebResourceLoadScheduler::preconnectTo(FrameLoader&, ResourceRequest&& request, StoredCredentialsPolicy, ShouldPreconnectAsFirstParty, PreconnectCompletionHandler&&)
+{
+    // The Java networking layer owns its connections, so warming the host
+    // name lookup is as far as a preconnect can go.
+    prefetchDNS(request.url().host().toString());
+}
+#else
 void WebResourceLoadScheduler::preconnectTo(FrameLoader&, ResourceRequest&&, StoredCredentialsPolicy, ShouldPreconnectAsFirstParty, PreconnectCompletionHandler&&)
 {
 }
+#endif
 
 #if PLATFORM(JAVA)
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -55,6 +55,7 @@
 #include <JavaScriptCore/Options.h>
 #include <WebCore/BackForwardController.h>
 #include <WebCore/BridgeUtils.h>
+#include <WebCore/BytecodeCacheJava.h>
 #include <WebCore/CharacterData.h>
 #include <WebCore/Chrome.h>
 #include <WebCore/ColorTypes.h>
@@ -191,6 +192,7 @@ void WebPage::setSize(const IntSize& size)
     if (m_rootLayer) {
         m_rootLayer->setSize(size);
         m_rootLayer->setNeedsDisplay();
+        *m_compositedDamage = Damage(size);
     }
 }
 
@@ -228,6 +230,9 @@ void WebPage::prePaint() {
         if (m_syncLayers) {
             m_syncLayers = false;
             syncLayers();
+            // A layer flush repaints the whole page, start it from the
+            // current state of the animations.
+            downcast<GraphicsLayerTextureMapper>(*m_rootLayer).layer().applyAnimationsRecursively(MonotonicTime::now());
         }
         return;
     }
@@ -252,7 +257,21 @@ RefPtr<RQRef> WebPage::jRenderTheme()
 
 void WebPage::paint(jobject rq, jint x, jint y, jint w, jint h)
 {
+    WTF::PerfCounters::TimerScope paintScope(WTF::PerfCounters::Timer::Paint);
+
     if (m_rootLayer) {
+        // Composited pages are rendered per dirty rect, so that only the
+        // damaged part of the page is repainted and sent to the render queue.
+        PlatformContextJava* ppgc = new PlatformContextJava(rq, jRenderTheme());
+        GraphicsContextJava gc(ppgc);
+
+        IntRect rect(x, y, w, h);
+        rect.intersect(pageRect());
+        if (!rect.isEmpty()) {
+            renderCompositedLayers(gc, rect);
+            WTF::PerfCounters::add(WTF::PerfCounters::Counter::CompositingPaintedPixels, rect.size().unclampedArea());
+        }
+        gc.platformContext()->rq().flushBuffer();
         return;
     }
 
@@ -299,12 +318,22 @@ void WebPage::postPaint(jobject rq, jint x, jint y, jint w, jint h)
             m_syncLayers = false;
             syncLayers();
         }
-        renderCompositedLayers(gc, IntRect(x, y, w, h));
+        WTF::PerfCounters::add(WTF::PerfCounters::Counter::CompositingFrames);
         if (m_page->settings().showDebugBorders()) {
             drawDebugLed(gc, IntRect(x, y, w, h), SRGBA<uint8_t> { 0, 192, 0, 128 });
         }
+        m_frameDamage = std::nullopt;
         if (downcast<GraphicsLayerTextureMapper>(m_rootLayer.get())->layer().descendantsOrSelfHaveRunningAnimations()) {
-            requestJavaRepaint(pageRect());
+            auto damage = advanceCompositedLayers(gc);
+            if (damage.isEmpty()) {
+                // Nothing visible moved in this frame, but the animations
+                // still need a frame to be scheduled to keep running.
+                requestJavaFrame();
+            } else {
+                for (const auto& rect : damage)
+                    requestJavaRepaint(rect);
+            }
+            m_frameDamage = WTFMove(damage);
         }
     }
 
@@ -362,6 +391,7 @@ void WebPage::requestJavaRepaint(const IntRect& rect)
             "(IIII)V");
     ASSERT(mid);
 
+    LOG_PERF_RECORD("WebPage", "fwkRepaint");
     env->CallVoidMethod(
             jobjectFromPage(m_page.get()),
             mid,
@@ -372,6 +402,23 @@ void WebPage::requestJavaRepaint(const IntRect& rect)
     WTF::CheckAndClearException(env);
 }
 
+// Schedules a frame with no damage, so that postPaint runs again without
+// any part of the page being repainted.
+void WebPage::requestJavaFrame()
+{
+    JNIEnv* env = WTF::GetJavaEnv();
+
+    static jmethodID mid = env->GetMethodID(
+            PG_GetWebPageClass(env),
+            "fwkScheduleFrame",
+            "()V");
+    ASSERT(mid);
+
+    LOG_PERF_RECORD("WebPage", "fwkScheduleFrame");
+    env->CallVoidMethod(jobjectFromPage(m_page.get()), mid);
+    WTF::CheckAndClearException(env);
+}
+
 void WebPage::setRootChildLayer(GraphicsLayer* layer)
 {
     if (layer) {
@@ -383,9 +430,14 @@ void WebPage::setRootChildLayer(GraphicsLayer* layer)
         m_rootLayer->addChild(*layer);
 
         m_textureMapper = std::make_unique<TextureMapperJavaAdapter>();
+        m_compositedDamage = std::make_shared<Damage>(pageRect().size());
+        m_damageVisualizer = TextureMapperDamageVisualizer::create();
     } else {
         m_rootLayer = nullptr;
         m_textureMapper.reset();
+        m_compositedDamage = nullptr;
+        m_frameDamage = std::nullopt;
+        m_damageVisualizer = nullptr;
     }
 }
 
@@ -449,11 +501,57 @@ void WebPage::renderCompositedLayers(GraphicsContext& context, const IntRect& cl
     TransformationMatrix matrix;
     m_textureMapper->beginPainting();
     m_textureMapper->beginClip(matrix, FloatRoundedRect(clip));
-    rootTextureMapperLayer.applyAnimationsRecursively(MonotonicTime::now());
     downcast<GraphicsLayerTextureMapper>(*m_rootLayer).updateBackingStoreIncludingSubLayers(*m_textureMapper);
+    // Animations are advanced once per frame by advanceCompositedLayers(),
+    // all the dirty rects of a frame are painted from the same layer state.
+    rootTextureMapperLayer.prepareForPainting(*m_textureMapper);
     rootTextureMapperLayer.paint(*m_textureMapper);
+    // WEBKIT_SHOW_DAMAGE highlights the rects repainted in this frame.
+    if (m_damageVisualizer)
+        m_damageVisualizer->paintDamage(*m_textureMapper, m_frameDamage);
     m_textureMapper->endClip();
     m_textureMapper->endPainting();
+    static_cast<TextureMapperJavaAdapter*>(m_textureMapper.get())->setGraphicsContext(nullptr);
+}
+
+static void enableDamagePropagation(GraphicsLayer& layer, const std::shared_ptr<Damage>& damage)
+{
+    TextureMapperLayer& textureMapperLayer = downcast<GraphicsLayerTextureMapper>(layer).layer();
+    textureMapperLayer.setDamagePropagationEnabled(true);
+    textureMapperLayer.setDamageInGlobalCoordinateSpace(damage);
+
+    if (auto* maskLayer = layer.maskLayer())
+        enableDamagePropagation(*maskLayer, damage);
+    if (auto* replicaLayer = layer.replicaLayer())
+        enableDamagePropagation(*replicaLayer, damage);
+    for (auto& child : layer.children())
+        enableDamagePropagation(child.get(), damage);
+}
+
+Damage WebPage::advanceCompositedLayers(GraphicsContext& context)
+{
+    ASSERT(m_rootLayer);
+    ASSERT(m_textureMapper);
+
+    const IntRect bounds = pageRect();
+    Damage damage(bounds.size());
+
+    // Layers may have been added since the previous frame.
+    enableDamagePropagation(*m_rootLayer, m_compositedDamage);
+
+    TextureMapperLayer& rootTextureMapperLayer = downcast<GraphicsLayerTextureMapper>(*m_rootLayer).layer();
+    rootTextureMapperLayer.applyAnimationsRecursively(MonotonicTime::now());
+
+    // Nothing is drawn here, the context only provides the clip bounds.
+    static_cast<TextureMapperJavaAdapter*>(m_textureMapper.get())->setGraphicsContext(&context);
+    m_textureMapper->beginPainting();
+    m_textureMapper->beginClipWithoutApplying(TransformationMatrix(), FloatRect(bounds));
+    rootTextureMapperLayer.prepareForPainting(*m_textureMapper);
+    rootTextureMapperLayer.collectDamage(*m_textureMapper, damage);
+    m_textureMapper->endClipWithoutApplying();
+    m_textureMapper->endPainting();
+    static_cast<TextureMapperJavaAdapter*>(m_textureMapper.get())->setGraphicsContext(nullptr);
+    return damage;
 }
 
 void WebPage::notifyAnimationStarted(const GraphicsLayer*, const String& /*animationKey*/, MonotonicTime /*time*/)
@@ -875,6 +973,9 @@ namespace {
 
 bool s_useJIT;
 bool s_useDFGJIT;
+bool s_useFTLJIT;
+bool s_useWebAssembly;
+bool s_useWasmFastMemory;
 bool s_useCSS3D;
 
 }  // namespace
@@ -882,10 +983,15 @@ bool s_useCSS3D;
 extern "C" {
 
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkInitWebCore
-    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useCSS3D) {
+    (JNIEnv* env, jclass self, jboolean useJIT, jboolean useDFGJIT, jboolean useFTLJIT,
+     jboolean useWebAssembly, jboolean useWasmFastMemory, jboolean useCSS3D, jint compositingTileSize) {
     s_useJIT = useJIT;
     s_useDFGJIT = useDFGJIT;
+    s_useFTLJIT = useFTLJIT;
+    s_useWebAssembly = useWebAssembly;
+    s_useWasmFastMemory = useWasmFastMemory;
     s_useCSS3D = useCSS3D;
+    TextureMapperJava::setTileSize(compositingTileSize);
 }
 
 JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
@@ -914,6 +1020,12 @@ JNIEXPORT jlong JNICALL Java_com_sun_webkit_WebPage_twkCreatePage
         JSC::Options::useJIT() = s_useJIT;
         // Enable DFG only if JIT is enabled.
         JSC::Options::useDFGJIT() = s_useJIT && s_useDFGJIT;
+        // Enable FTL only if DFG is enabled.
+        JSC::Options::useFTLJIT() = JSC::Options::useDFGJIT() && s_useFTLJIT;
+#if ENABLE(WEBASSEMBLY)
+        JSC::Options::useWasm() = JSC::Options::useWasm() && s_useWebAssembly;
+        JSC::Options::useWasmFastMemory() = JSC::Options::useWasmFastMemory() && s_useWasmFastMemory;
+#endif
     });
 
     JLObject jlself(self, true);
@@ -2509,6 +2621,50 @@ JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLocalStorageDatabasePat
         ->setLocalStorageDatabasePath(settings.localStorageDatabasePath());
 }
 
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetBytecodeCacheDirectory
+  (JNIEnv* env, jclass, jstring directory, jlong maxSize)
+{
+    BytecodeCacheJava::setDirectory(directory ? String(env, directory) : String(), maxSize);
+}
+
+JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetPerfCountersEnabled
+  (JNIEnv*, jclass, jboolean enabled)
+{
+    WTF::PerfCounters::setEnabled(jbool_to_bool(enabled));
+}
+
+JNIEXPORT jobject JNICALL Java_com_sun_webkit_WebPage_twkGetPerfCounters
+  (JNIEnv* env, jclass)
+{
+    static JGClass perfCountersClass(env->FindClass("com/sun/webkit/perf/PerfCounters"));
+    static jmethodID perfCountersCTOR = env->GetMethodID(perfCountersClass,
+        "<init>", "([Ljava/lang/String;[J[JI)V");
+    ASSERT(perfCountersCTOR);
+    static JGClass clsString(env->FindClass("java/lang/String"));
+
+    auto entries = WTF::PerfCounters::snapshot();
+    jsize size = entries.size();
+    JLObjectArray names(env->NewObjectArray(size, clsString, nullptr));
+    jlongArray counts = env->NewLongArray(size);
+    jlongArray nanoseconds = env->NewLongArray(size);
+    if (WTF::CheckAndClearException(env)) // OOME
+        return nullptr;
+
+    for (jsize i = 0; i < size; ++i) {
+        env->SetObjectArrayElement(names, i, (jstring)JLString(env->NewStringUTF(entries[i].name)));
+        jlong count = static_cast<jlong>(entries[i].count);
+        jlong time = static_cast<jlong>(entries[i].nanoseconds);
+        env->SetLongArrayRegion(counts, i, 1, &count);
+        env->SetLongArrayRegion(nanoseconds, i, 1, &time);
+    }
+
+    jobject result = env->NewObject(perfCountersClass, perfCountersCTOR,
+        (jobjectArray)names, counts, nanoseconds,
+        static_cast<jint>(WTF::PerfCounters::CounterCount + WTF::PerfCounters::TimerCount));
+    WTF::CheckAndClearException(env);
+    return result;
+}
+
 JNIEXPORT void JNICALL Java_com_sun_webkit_WebPage_twkSetLocalStorageEnabled
   (JNIEnv*, jobject, jlong pPage, jboolean enabled)
 {
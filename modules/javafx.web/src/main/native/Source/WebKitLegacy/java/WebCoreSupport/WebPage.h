@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -27,6 +27,7 @@
 
 #include <wtf/OptionSet.h>
 #include <wtf/java/JavaRef.h>
+#include <WebCore/Damage.h>
 #include <WebCore/GraphicsLayerClient.h>
 #include <WebCore/IntRect.h>
 #include <WebCore/PrintContext.h>
@@ -35,6 +36,7 @@
 
 #include "MediaPlayerPrivateJava.h"
 #include "TextureMapperJavaAdapter.h"
+#include <WebCore/TextureMapperDamageVisualizer.h>
 
 #include <jni.h> // todo tav remove when building w/ pch
 
@@ -107,10 +109,12 @@ public:
 
 private:
     void requestJavaRepaint(const IntRect&);
+    void requestJavaFrame();
     void markForSync();
     void syncLayers();
     IntRect pageRect();
     void renderCompositedLayers(GraphicsContext&, const IntRect&);
+    Damage advanceCompositedLayers(GraphicsContext&);
 
     // GraphicsLayerClient
     void notifyAnimationStarted(const GraphicsLayer*, const String& /*animationKey*/, MonotonicTime /*time*/) override;
@@ -136,6 +140,10 @@ private:
     RefPtr<GraphicsLayer> m_rootLayer;
     std::unique_ptr<TextureMapper> m_textureMapper;
     bool m_syncLayers { false };
+    // The part of the page that changed since the previous composited frame.
+    std::shared_ptr<Damage> m_compositedDamage;
+    std::optional<Damage> m_frameDamage;
+    std::unique_ptr<TextureMapperDamageVisualizer> m_damageVisualizer;
 
     // Webkit expects keyPress events to be suppressed if the associated keyDown
     // event was handled. Safari implements this behavior by peeking out the
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -23,27 +23,20 @@
  * questions.
  */
 
-package com.sun.javafx.webkit;
+package com.sun.webkit;
 
-import com.sun.webkit.security.WCMessageDigest;
-import java.nio.ByteBuffer;
-import java.security.MessageDigest;
-import java.security.NoSuchAlgorithmException;
+public class CryptoDigestShim {
 
-public class WCMessageDigestImpl extends WCMessageDigest {
-    private final MessageDigest digest;
-
-    public WCMessageDigestImpl(String algorithm) throws NoSuchAlgorithmException {
-        digest = MessageDigest.getInstance(algorithm);
-    }
-
-    @Override
-    public void addBytes(ByteBuffer input) {
-        digest.update(input);
-    }
-
-    @Override
-    public byte[] computeHash() {
-        return digest.digest();
+    public static byte[] digest(String algorithm, byte[] data, int... chunkSizes) {
+        final CryptoDigest digest = new CryptoDigest(algorithm);
+        int offset = 0;
+        for (int i = 0; offset < data.length; i++) {
+            final int length = chunkSizes.length == 0
+                    ? data.length
+                    : Math.min(chunkSizes[i % chunkSizes.length], data.length - offset);
+            digest.addBytes(data, offset, length);
+            offset += length;
+        }
+        return digest.computeHash();
     }
 }
@@ -1,61 +0,0 @@
-/*
- * Copyright (c) 2015, Oracle and/or its affiliates. All rights reserved.
- * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
- *
- * This code is free software; you can redistribute it and/or modify it
- * under the terms of the GNU General Public License version 2 only, as
- * published by the Free Software Foundation.  Oracle designates this
- * particular file as subject to the "Classpath" exception as provided
- * by Oracle in the LICENSE file that accompanied this code.
- *
- * This code is distributed in the hope that it will be useful, but WITHOUT
- * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
- * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
- * version 2 for more details (a copy is included in the LICENSE file that
- * accompanied this code).
- *
- * You should have received a copy of the GNU General Public License version
- * 2 along with this work; if not, write to the Free Software Foundation,
- * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
- *
- * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
- * or visit www.oracle.com if you need additional information or have any
- * questions.
- */
-package com.sun.webkit.text;
-
-import java.text.BreakIterator;
-
-public class TextBreakIteratorShim {
-
-    // Break iterator types
-    public static final int CHARACTER_ITERATOR = TextBreakIterator.CHARACTER_ITERATOR;
-    public static final int WORD_ITERATOR = TextBreakIterator.WORD_ITERATOR;
-    public static final int LINE_ITERATOR = TextBreakIterator.LINE_ITERATOR;
-    public static final int SENTENCE_ITERATOR = TextBreakIterator.SENTENCE_ITERATOR;
-
-    // Break iterator methods
-    public static final int TEXT_BREAK_FIRST = TextBreakIterator.TEXT_BREAK_FIRST;
-    public static final int TEXT_BREAK_LAST = TextBreakIterator.TEXT_BREAK_LAST;
-    public static final int TEXT_BREAK_NEXT = TextBreakIterator.TEXT_BREAK_NEXT;
-    public static final int TEXT_BREAK_PREVIOUS = TextBreakIterator.TEXT_BREAK_PRECEDING;
-    public static final int TEXT_BREAK_CURRENT = TextBreakIterator.TEXT_BREAK_CURRENT;
-    public static final int TEXT_BREAK_PRECEDING = TextBreakIterator.TEXT_BREAK_PRECEDING;
-    public static final int TEXT_BREAK_FOLLOWING = TextBreakIterator.TEXT_BREAK_FOLLOWING;
-    public static final int IS_TEXT_BREAK = TextBreakIterator.IS_TEXT_BREAK;
-    public static final int IS_WORD_TEXT_BREAK = TextBreakIterator.IS_WORD_TEXT_BREAK;
-
-    public static BreakIterator getIterator(
-        int type,
-        String localeName,
-        String text,
-        boolean create) {
-        return TextBreakIterator.getIterator(type, localeName, text, create);
-    }
-
-    public static int invokeMethod(BreakIterator iterator, int method, int pos) {
-        return TextBreakIterator.invokeMethod(iterator, method, pos);
-
-    }
-
-}
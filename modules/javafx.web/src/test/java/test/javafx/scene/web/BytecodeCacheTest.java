@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.javafx.PlatformUtil;
+import com.sun.webkit.WebPage;
+import com.sun.webkit.perf.PerfCounters;
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.attribute.PosixFilePermissions;
+import java.util.List;
+import java.util.concurrent.CopyOnWriteArrayList;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.AfterEach;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.api.io.TempDir;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeFalse;
+
+public class BytecodeCacheTest extends TestBase {
+
+    @TempDir
+    Path tempDir;
+
+    @BeforeAll
+    public static void enablePerfCounters() {
+        WebPage.setPerfCountersEnabled(true);
+    }
+
+    @AfterAll
+    public static void disablePerfCounters() {
+        WebPage.setPerfCountersEnabled(false);
+    }
+
+    @AfterEach
+    public void disableBytecodeCache() {
+        submit(() -> WebPage.setBytecodeCacheDirectory(null));
+        WebPage.setFileAccessPolicy(null);
+    }
+
+    /**
+     * Running an external script with the cache enabled should look it up
+     * and store the generated bytecode in the cache directory.
+     */
+    @Test public void testBytecodeCacheStore() throws IOException {
+        // Files are only written and mapped natively on Unix
+        assumeFalse(PlatformUtil.isWindows());
+
+        Path cacheDir = tempDir.resolve("bytecode");
+        Files.writeString(tempDir.resolve("script.js"),
+                "var bytecodeCacheTestValue = [1, 2, 3].map(x => x * 2).join();");
+        Path page = Files.writeString(tempDir.resolve("page.html"),
+                "<html><body><script src='script.js'></script></body></html>");
+
+        submit(() -> WebPage.setBytecodeCacheDirectory(cacheDir.toString()));
+        final PerfCounters before = WebPage.getPerfCounters();
+
+        load(new File(page.toString()));
+        assertEquals("2,4,6", executeScript("bytecodeCacheTestValue"));
+
+        final PerfCounters delta = WebPage.getPerfCounters().since(before);
+        assertTrue(delta.getCount("BytecodeCache.misses") > 0, "Cache misses should grow:\n" + delta);
+        assertTrue(delta.getCount("BytecodeCache.commits") > 0, "Cache commits should grow:\n" + delta);
+        try (var files = Files.list(cacheDir)) {
+            assertTrue(files.anyMatch(f -> f.toString().endsWith(".bytecode-cache")));
+        }
+    }
+
+    /**
+     * Loading the page again should find the entry the first load wrote,
+     * which only its owner can read or write.
+     */
+    @Test public void testBytecodeCacheHit() throws IOException {
+        assumeFalse(PlatformUtil.isWindows());
+
+        Path cacheDir = tempDir.resolve("bytecode");
+        Files.writeString(tempDir.resolve("script.js"),
+                "var bytecodeCacheTestValue = [1, 2, 3].map(x => x * 2).join();");
+        Path page = Files.writeString(tempDir.resolve("page.html"),
+                "<html><body><script src='script.js'></script></body></html>");
+
+        submit(() -> WebPage.setBytecodeCacheDirectory(cacheDir.toString()));
+        load(new File(page.toString()));
+        assertEquals("2,4,6", executeScript("bytecodeCacheTestValue"));
+        try (var files = Files.list(cacheDir)) {
+            for (Path file : files.toList()) {
+                assertTrue(file.toString().endsWith(".bytecode-cache"), "Unexpected file: " + file);
+                assertEquals("rw-------", PosixFilePermissions.toString(Files.getPosixFilePermissions(file)));
+            }
+        }
+
+        final PerfCounters before = WebPage.getPerfCounters();
+        load(new File(page.toString()));
+        assertEquals("2,4,6", executeScript("bytecodeCacheTestValue"));
+
+        final PerfCounters delta = WebPage.getPerfCounters().since(before);
+        assertTrue(delta.getCount("BytecodeCache.hits") > 0, "Cache hits should grow:\n" + delta);
+    }
+
+    /**
+     * Entries over the size limit are deleted once they are written.
+     */
+    @Test public void testBytecodeCacheSizeLimit() throws IOException {
+        assumeFalse(PlatformUtil.isWindows());
+
+        Path cacheDir = tempDir.resolve("bytecode");
+        Files.writeString(tempDir.resolve("script.js"),
+                "var bytecodeCacheTestValue = [1, 2, 3].map(x => x * 2).join();");
+        Path page = Files.writeString(tempDir.resolve("page.html"),
+                "<html><body><script src='script.js'></script></body></html>");
+
+        submit(() -> WebPage.setBytecodeCacheDirectory(cacheDir.toString(), 1));
+        final PerfCounters before = WebPage.getPerfCounters();
+
+        load(new File(page.toString()));
+        assertEquals("2,4,6", executeScript("bytecodeCacheTestValue"));
+
+        final PerfCounters delta = WebPage.getPerfCounters().since(before);
+        assertTrue(delta.getCount("BytecodeCache.commits") > 0, "Cache commits should grow:\n" + delta);
+        try (var files = Files.list(cacheDir)) {
+            assertFalse(files.anyMatch(f -> f.toString().endsWith(".bytecode-cache")));
+        }
+    }
+
+    /**
+     * The embedder policy is consulted for the cache files and can deny
+     * writes even in the cache directory.
+     */
+    @Test public void testFileAccessPolicyDeniesWrites() throws IOException {
+        assumeFalse(PlatformUtil.isWindows());
+
+        Path cacheDir = tempDir.resolve("bytecode");
+        Files.writeString(tempDir.resolve("script.js"),
+                "var bytecodeCacheTestValue = [1, 2, 3].map(x => x * 2).join();");
+        Path page = Files.writeString(tempDir.resolve("page.html"),
+                "<html><body><script src='script.js'></script></body></html>");
+
+        final List<String> denied = new CopyOnWriteArrayList<>();
+        WebPage.setFileAccessPolicy((path, write) -> {
+            if (write) {
+                denied.add(path);
+            }
+            return !write;
+        });
+        submit(() -> WebPage.setBytecodeCacheDirectory(cacheDir.toString()));
+
+        load(new File(page.toString()));
+        assertEquals("2,4,6", executeScript("bytecodeCacheTestValue"));
+
+        assertFalse(denied.isEmpty(), "The policy should be asked about the cache files");
+        if (Files.isDirectory(cacheDir)) {
+            try (var files = Files.list(cacheDir)) {
+                assertFalse(files.anyMatch(f -> f.toString().endsWith(".bytecode-cache")));
+            }
+        }
+    }
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2025, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2026, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -119,6 +119,45 @@ public class CanvasTest extends TestBase {
         });
     }
 
+    /**
+     * A small putImageData tile must be visible to getImageData, drawing
+     * after it must not be hidden by the cached pixel buffer, and a tile that
+     * is partly outside of the canvas must be clipped.
+     */
+    @Test public void testPutImageDataTile() {
+        final String htmlCanvas =
+                "<canvas id='canvas' width='100' height='100'></canvas> <script>" +
+                        "var ctx = document.getElementById('canvas').getContext('2d');" +
+                        "ctx.fillStyle = 'blue';" +
+                        "ctx.fillRect(0, 0, 100, 100);" +
+                        "function tile(x, y, size) {" +
+                        "    var img = ctx.createImageData(size, size);" +
+                        "    for (var i = 0; i < img.data.length; i += 4) {" +
+                        "        img.data[i + 1] = 255; img.data[i + 3] = 255;" +
+                        "    }" +
+                        "    ctx.putImageData(img, x, y);" +
+                        "}" +
+                        "function pixel(x, y) {" +
+                        "    return Array.from(ctx.getImageData(x, y, 1, 1).data).join(',');" +
+                        "} </script>";
+
+        loadContent(htmlCanvas);
+        submit(() -> {
+            getEngine().executeScript("tile(20, 20, 16)");
+            assertEquals("0,255,0,255", getEngine().executeScript("pixel(20, 20)"), "Inside the tile");
+            assertEquals("0,255,0,255", getEngine().executeScript("pixel(35, 35)"), "Inside the tile");
+            assertEquals("0,0,255,255", getEngine().executeScript("pixel(36, 36)"), "Outside the tile");
+
+            getEngine().executeScript("ctx.fillStyle = 'red'; ctx.fillRect(20, 20, 4, 4)");
+            assertEquals("255,0,0,255", getEngine().executeScript("pixel(21, 21)"), "Drawn over the tile");
+            assertEquals("0,255,0,255", getEngine().executeScript("pixel(30, 30)"), "Rest of the tile");
+
+            getEngine().executeScript("tile(90, 90, 16)");
+            assertEquals("0,255,0,255", getEngine().executeScript("pixel(99, 99)"), "Clipped tile");
+            assertEquals("0,0,255,255", getEngine().executeScript("pixel(89, 89)"), "Outside the clipped tile");
+        });
+    }
+
     // JDK-8234471
     @Test public void testCanvasPattern() throws Exception {
         final String htmlCanvasContent = "\n"
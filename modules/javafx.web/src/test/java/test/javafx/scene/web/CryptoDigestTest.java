@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.CryptoDigestShim;
+import java.security.MessageDigest;
+import java.util.Random;
+import java.util.stream.Stream;
+import org.junit.jupiter.api.Test;
+import org.junit.jupiter.params.ParameterizedTest;
+import org.junit.jupiter.params.provider.Arguments;
+import org.junit.jupiter.params.provider.MethodSource;
+import static org.junit.jupiter.api.Assertions.assertArrayEquals;
+import static org.junit.jupiter.api.Assertions.assertThrows;
+
+/**
+ * Checks the native SHA-2 digests against java.security.MessageDigest.
+ * The lengths around 56 and 112 bytes are where the SHA-256 and SHA-512
+ * padding needs an extra block.
+ */
+public class CryptoDigestTest extends TestBase {
+
+    private static final String[] ALGORITHMS = {
+        "SHA-1", "SHA-224", "SHA-256", "SHA-384", "SHA-512"
+    };
+
+    private static final int[] LENGTHS = {
+        0, 1, 3, 55, 56, 63, 64, 65, 111, 112, 127, 128, 129, 1000
+    };
+
+    private static final Random random = new Random(8);
+
+    static Stream<Arguments> algorithms() {
+        return Stream.of(ALGORITHMS).map(Arguments::of);
+    }
+
+    private static byte[] randomBytes(int length) {
+        final byte[] data = new byte[length];
+        random.nextBytes(data);
+        return data;
+    }
+
+    private static void assertDigest(String algorithm, byte[] data, int... chunkSizes) throws Exception {
+        final byte[] expected = MessageDigest.getInstance(algorithm).digest(data);
+        assertArrayEquals(expected, CryptoDigestShim.digest(algorithm, data, chunkSizes),
+                algorithm + " of " + data.length + " bytes");
+    }
+
+    @ParameterizedTest
+    @MethodSource("algorithms")
+    public void testKnownLengths(String algorithm) throws Exception {
+        for (int length : LENGTHS) {
+            assertDigest(algorithm, randomBytes(length));
+        }
+    }
+
+    @ParameterizedTest
+    @MethodSource("algorithms")
+    public void testLargeInput(String algorithm) throws Exception {
+        assertDigest(algorithm, randomBytes(4 * 1024 * 1024 + 17));
+    }
+
+    @ParameterizedTest
+    @MethodSource("algorithms")
+    public void testChunkedUpdates(String algorithm) throws Exception {
+        final byte[] data = randomBytes(64 * 1024 + 5);
+        assertDigest(algorithm, data, 1);
+        assertDigest(algorithm, data, 7, 64, 3, 128, 1, 200);
+        assertDigest(algorithm, data, 55, 9, 112, 16);
+        assertDigest(algorithm, data, 1000, 24 * 1024);
+        for (int length : LENGTHS) {
+            assertDigest(algorithm, randomBytes(length), 3, 60, 1);
+        }
+    }
+
+    @Test
+    public void testUnsupportedAlgorithm() {
+        assertThrows(IllegalArgumentException.class,
+                () -> CryptoDigestShim.digest("MD5", new byte[0]));
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.WebPage;
+import com.sun.webkit.perf.PerfCounters;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+public class DNSPrefetchTest extends TestBase {
+
+    private static final String PAGE =
+            "<html><head><link rel='dns-prefetch' href='http://localhost/'></head><body></body></html>";
+
+    @BeforeAll
+    public static void enablePerfCounters() {
+        WebPage.setPerfCountersEnabled(true);
+    }
+
+    @AfterAll
+    public static void disablePerfCounters() {
+        WebPage.setPerfCountersEnabled(false);
+    }
+
+    /**
+     * Waits until the given number of lookups completed since the given
+     * snapshot, as they are counted when queued, and returns the delta.
+     */
+    private PerfCounters waitForLookups(PerfCounters before, long count) throws InterruptedException {
+        PerfCounters delta = WebPage.getPerfCounters().since(before);
+        for (int i = 0; i < 100 && delta.getCount("DNSPrefetch.completed") < count; i++) {
+            Thread.sleep(50);
+            delta = WebPage.getPerfCounters().since(before);
+        }
+        return delta;
+    }
+
+    /**
+     * A dns-prefetch hint for a host listed in /etc/hosts should be looked up
+     * once, and the same hint on a later page should be served from the cache.
+     */
+    @Test public void testPrefetchHit() throws InterruptedException {
+        // Host names are not prefetched when requests go through a proxy
+        assumeTrue(System.getProperty("http.proxyHost") == null);
+
+        final PerfCounters before = WebPage.getPerfCounters();
+        loadContent(PAGE);
+        final PerfCounters resolved = waitForLookups(before, 1);
+        assertTrue(resolved.getCount("DNSPrefetch.completed") > 0, "localhost should be looked up:\n" + resolved);
+        assertEquals(0, resolved.getCount("DNSPrefetch.failures"), "localhost should resolve:\n" + resolved);
+
+        final PerfCounters middle = WebPage.getPerfCounters();
+        loadContent(PAGE);
+        final PerfCounters delta = WebPage.getPerfCounters().since(middle);
+        assertTrue(delta.getCount("DNSPrefetch.hits") > 0, "Cache hits should grow:\n" + delta);
+        assertEquals(0, delta.getCount("DNSPrefetch.lookups"), "localhost should not be looked up again:\n" + delta);
+    }
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.WebPage;
+import com.sun.webkit.perf.PerfCounters;
+import java.util.List;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assertions.assertFalse;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+public class PerfCountersTest extends TestBase {
+
+    @BeforeAll
+    public static void enablePerfCounters() {
+        WebPage.setPerfCountersEnabled(true);
+    }
+
+    @AfterAll
+    public static void disablePerfCounters() {
+        WebPage.setPerfCountersEnabled(false);
+    }
+
+    /**
+     * Forcing a style change and a layout from script should show up in the
+     * native style and layout timers.
+     */
+    @Test public void testStyleAndLayout() {
+        loadContent("<html><body><div id='d'>text</div></body></html>");
+
+        final PerfCounters before = WebPage.getPerfCounters();
+        executeScript("document.getElementById('d').style.width = '10px'; document.body.offsetHeight");
+        final PerfCounters delta = WebPage.getPerfCounters().since(before);
+
+        assertTrue(delta.getCount("StyleRecalc") > 0, "Style should be recalculated:\n" + delta);
+        assertTrue(delta.getCount("Layout") > 0, "Layout should run:\n" + delta);
+        assertTrue(delta.getTotalTime("Layout") > 0, "Layout should take time:\n" + delta);
+    }
+
+    /**
+     * Parsing of a local page is timed too, and the JNI up-call sites are
+     * told apart from the counters and timers.
+     */
+    @Test public void testParseAndCallSites() {
+        final PerfCounters before = WebPage.getPerfCounters();
+        loadContent("<html><body><p>text</p><script>document.write('<p>more</p>')</script></body></html>");
+        final PerfCounters delta = WebPage.getPerfCounters().since(before);
+
+        assertTrue(delta.getCount("Parse") > 0, "Parsing should be timed:\n" + delta);
+        final List<String> callSites = delta.getCallSiteNames();
+        assertFalse(callSites.isEmpty(), delta.toString());
+        assertFalse(callSites.contains("Parse"), callSites.toString());
+        assertFalse(callSites.contains("RenderingQueue.bytes"), callSites.toString());
+    }
+
+    /**
+     * Adjacent canvas rects of one color are sent as a single command, and
+     * save/restore pairs with nothing in between are not sent at all,
+     * without changing what ends up on the canvas.
+     */
+    @Test public void testRedundantCommandsElided() {
+        loadContent("<html><body><canvas id='c' width='100' height='10'></canvas></body></html>");
+
+        final PerfCounters before = WebPage.getPerfCounters();
+        final Object pixel = executeScript(
+                "var ctx = document.getElementById('c').getContext('2d');"
+                + "for (var i = 0; i < 10; i++) {"
+                + "    ctx.save(); ctx.restore();"
+                + "    ctx.fillStyle = 'rgb(0, 128, 255)';"
+                + "    ctx.fillRect(i * 10, 0, 10, 10);"
+                + "}"
+                + "Array.from(ctx.getImageData(55, 5, 1, 1).data).join(',')");
+        final PerfCounters delta = WebPage.getPerfCounters().since(before);
+
+        assertEquals("0,128,255,255", pixel);
+        final long elided = delta.getCount("RenderingQueue.elidedCommands");
+        assertTrue(elided > 0, "Commands should be elided:\n" + delta);
+        assertTrue(delta.getCount("RenderingQueue.trackedCommands") >= elided, delta.toString());
+        assertTrue(delta.getCount("RenderingQueue.elidedBytes") >= 4 * elided, delta.toString());
+    }
+
+    /**
+     * Paths drawn on a canvas get their ids on the native side, and the java
+     * side still finds them when the queue is decoded.
+     */
+    @Test public void testNativeRefIDs() {
+        loadContent("<html><body><canvas id='c' width='100' height='10'></canvas></body></html>");
+
+        final PerfCounters before = WebPage.getPerfCounters();
+        final Object pixel = executeScript(
+                "var ctx = document.getElementById('c').getContext('2d');"
+                + "ctx.fillStyle = 'rgb(255, 128, 0)';"
+                + "for (var i = 0; i < 10; i++) {"
+                + "    ctx.beginPath();"
+                + "    ctx.rect(i * 10, 0, 10, 10);"
+                + "    ctx.fill();"
+                + "}"
+                + "Array.from(ctx.getImageData(55, 5, 1, 1).data).join(',')");
+        final PerfCounters delta = WebPage.getPerfCounters().since(before);
+
+        assertEquals("255,128,0,255", pixel);
+        assertTrue(delta.getCount("RQRef.assigned") >= 10, "Paths should get native ids:\n" + delta);
+    }
+
+    /**
+     * Nothing is counted while the counters are disabled.
+     */
+    @Test public void testDisabled() {
+        WebPage.setPerfCountersEnabled(false);
+        try {
+            final PerfCounters before = WebPage.getPerfCounters();
+            loadContent("<html><body><p>text</p></body></html>");
+            final PerfCounters delta = WebPage.getPerfCounters().since(before);
+
+            assertEquals(0, delta.getCount("Parse"), delta.toString());
+            assertEquals(0, delta.getCount("RenderingQueue.buffers"), delta.toString());
+            for (String site : delta.getCallSiteNames()) {
+                assertEquals(0, delta.getCount(site), site);
+            }
+        } finally {
+            WebPage.setPerfCountersEnabled(true);
+        }
+    }
+
+    /**
+     * The snapshot does not need the event thread.
+     */
+    @Test public void testSnapshotOffEventThread() {
+        final PerfCounters counters = WebPage.getPerfCounters();
+        assertTrue(counters.getNames().contains("RenderingQueue.bytes"), counters.toString());
+        assertTrue(counters.getNames().contains("Paint"), counters.toString());
+        assertTrue(counters.getNames().contains("Decode"), counters.toString());
+        assertFalse(counters.getCallSiteNames().contains("Decode"), counters.toString());
+    }
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import com.sun.webkit.WebPage;
+import com.sun.webkit.WebPageShim;
+import com.sun.webkit.perf.PerfCounters;
+import javafx.scene.web.WebEngineShim;
+import org.junit.jupiter.api.AfterAll;
+import org.junit.jupiter.api.BeforeAll;
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertNotNull;
+import static org.junit.jupiter.api.Assertions.assertTrue;
+
+public class RenderQueueTest extends TestBase {
+
+    @BeforeAll
+    public static void enablePerfCounters() {
+        WebPage.setPerfCountersEnabled(true);
+    }
+
+    @AfterAll
+    public static void disablePerfCounters() {
+        WebPage.setPerfCountersEnabled(false);
+    }
+
+    /**
+     * Repainting a page should reuse the native buffers released by
+     * the previous paint instead of allocating new ones.
+     */
+    @Test public void testBufferPoolReuse() {
+        loadContent("<html><body style='background-color:#00f;'>"
+                + "<p>text</p><p>more text</p></body></html>");
+        final WebPage webPage = WebEngineShim.getPage(getEngine());
+        assertNotNull(webPage);
+
+        // The first paint primes the pool.
+        submit(() -> {
+            WebPageShim.paint(webPage, 0, 0, 800, 600);
+        });
+        final PerfCounters before = WebPage.getPerfCounters();
+
+        for (int i = 0; i < 3; i++) {
+            submit(() -> {
+                WebPageShim.paint(webPage, 0, 0, 800, 600);
+            });
+        }
+        final PerfCounters delta = WebPage.getPerfCounters().since(before);
+        assertTrue(delta.getCount("RenderingQueue.poolHits") > 0, "Pool hits should grow:\n" + delta);
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package test.javafx.scene.web;
+
+import org.junit.jupiter.api.BeforeEach;
+import org.junit.jupiter.api.Test;
+import static org.junit.jupiter.api.Assertions.assertEquals;
+import static org.junit.jupiter.api.Assumptions.assumeTrue;
+
+public class WebAssemblyTest extends TestBase {
+
+    // (func (export "sumOfSquares") (param $n i32) (result i32)
+    //   (local $acc i32)
+    //   (block (loop
+    //     (br_if 1 (i32.eqz (local.get $n)))
+    //     (local.set $acc (i32.add (local.get $acc) (i32.mul (local.get $n) (local.get $n))))
+    //     (local.set $n (i32.sub (local.get $n) (i32.const 1)))
+    //     (br 0)))
+    //   (local.get $acc))
+    private static final String MODULE =
+            "new Uint8Array(["
+            + "0x00,0x61,0x73,0x6d,0x01,0x00,0x00,0x00,0x01,0x06,0x01,0x60,0x01,0x7f,0x01,0x7f,"
+            + "0x03,0x02,0x01,0x00,0x07,0x10,0x01,0x0c,0x73,0x75,0x6d,0x4f,0x66,0x53,0x71,0x75,"
+            + "0x61,0x72,0x65,0x73,0x00,0x00,0x0a,0x26,0x01,0x24,0x01,0x01,0x7f,0x02,0x40,0x03,"
+            + "0x40,0x20,0x00,0x45,0x0d,0x01,0x20,0x01,0x20,0x00,0x20,0x00,0x6c,0x6a,0x21,0x01,"
+            + "0x20,0x00,0x41,0x01,0x6b,0x21,0x00,0x0c,0x00,0x0b,0x0b,0x20,0x01,0x0b])";
+
+    private static final String JS_SUM_OF_SQUARES =
+            "function jsSumOfSquares(n) {"
+            + "    var acc = 0;"
+            + "    for (; n; n--) acc = (acc + Math.imul(n, n)) | 0;"
+            + "    return acc;"
+            + "}";
+
+    @BeforeEach
+    public void setup() {
+        loadContent("<html><body></body></html>");
+        // WebAssembly is only built on some platforms
+        assumeTrue((Boolean) executeScript("typeof WebAssembly === 'object'"));
+        executeScript(JS_SUM_OF_SQUARES
+                + "var wasm = new WebAssembly.Instance(new WebAssembly.Module(" + MODULE + ")).exports;");
+    }
+
+    @Test public void testSmallKernel() {
+        assertEquals(385, ((Number) executeScript("wasm.sumOfSquares(10)")).intValue());
+        assertEquals(0, ((Number) executeScript("wasm.sumOfSquares(0)")).intValue());
+    }
+
+    /**
+     * A long running loop should tier up and keep computing the same
+     * (wrapping) result as the equivalent JavaScript.
+     */
+    @Test public void testHotKernel() {
+        final int n = 1_000_000;
+        final int expected = ((Number) executeScript("jsSumOfSquares(" + n + ")")).intValue();
+        for (int i = 0; i < 20; i++) {
+            final Object result = executeScript("wasm.sumOfSquares(" + n + ")");
+            assertEquals(expected, ((Number) result).intValue(), "Iteration " + i);
+        }
+    }
+
+    @Test public void testMemoryGrow() {
+        final Object pages = executeScript(
+                "var memory = new WebAssembly.Memory({ initial: 1, maximum: 256 });"
+                + "memory.grow(15);"
+                + "new Uint8Array(memory.buffer)[16 * 65536 - 1] = 42;"
+                + "memory.buffer.byteLength / 65536");
+        assertEquals(16, ((Number) pages).intValue());
+    }
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package web;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+import javafx.animation.AnimationTimer;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.Scene;
+import javafx.scene.web.WebEngine;
+import javafx.scene.web.WebView;
+import javafx.stage.Stage;
+
+/**
+ * The skeleton shared by the benchmarks in this package: reading the
+ * arguments, creating the engine, waiting for the page to load, timing and
+ * exiting. A benchmark implements {@link #run(Stage)} and keeps a
+ * {@code main} that launches it.
+ */
+public abstract class Benchmark extends Application {
+
+    private List<String> args;
+    private long t0;
+
+    @Override
+    public final void start(Stage stage) throws Exception {
+        args = getParameters().getRaw();
+        run(stage);
+    }
+
+    /**
+     * Starts the benchmark on the FX application thread. The benchmark
+     * calls {@link Platform#exit()} once it is done.
+     */
+    protected abstract void run(Stage stage) throws Exception;
+
+    protected int argCount() {
+        return args.size();
+    }
+
+    protected String arg(int index) {
+        return args.get(index);
+    }
+
+    protected int intArg(int index, int defaultValue) {
+        return index < args.size() ? Integer.parseInt(args.get(index)) : defaultValue;
+    }
+
+    /**
+     * Returns the engine of a WebView shown in a 1024x768 window.
+     */
+    protected static WebEngine showWebView(Stage stage) {
+        WebView view = new WebView();
+        stage.setScene(new Scene(view, 1024, 768));
+        stage.show();
+        return view.getEngine();
+    }
+
+    /**
+     * Loads the page and, once it has loaded, runs {@code onLoaded} on a
+     * later pulse. Exits if the page fails to load.
+     */
+    protected static void loadContent(WebEngine engine, String page, Runnable onLoaded) {
+        engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+            if (n == Worker.State.SUCCEEDED) {
+                Platform.runLater(onLoaded);
+            } else if (n == Worker.State.FAILED) {
+                System.out.println("page: " + n);
+                Platform.exit();
+            }
+        });
+        engine.loadContent(page);
+    }
+
+    /**
+     * Loads the URL on a later pulse and restarts the clock as the load
+     * starts.
+     */
+    protected void timedLoad(WebEngine engine, String url) {
+        Platform.runLater(() -> {
+            startClock();
+            engine.load(url);
+        });
+    }
+
+    /**
+     * Restarts the clock, and then calls {@code onFrame} on every animation
+     * frame for the given number of seconds. Then calls {@code report} and
+     * exits.
+     */
+    protected void runFrames(int seconds, Runnable onFrame, Runnable report) {
+        startClock();
+        new AnimationTimer() {
+            @Override
+            public void handle(long now) {
+                onFrame.run();
+                if (now - t0 < seconds * 1_000_000_000L) {
+                    return;
+                }
+                stop();
+                report.run();
+                Platform.exit();
+            }
+        }.start();
+    }
+
+    protected void startClock() {
+        t0 = System.nanoTime();
+    }
+
+    /**
+     * Returns the seconds elapsed since the clock was last restarted.
+     */
+    protected double elapsedSeconds() {
+        return (System.nanoTime() - t0) / 1e9;
+    }
+
+    /**
+     * Creates a temporary directory that is deleted on exit, along with the
+     * files created in it through {@link #tempFile(Path, String)}.
+     */
+    protected static Path createTempDirectory(String prefix) throws IOException {
+        Path dir = Files.createTempDirectory(prefix);
+        dir.toFile().deleteOnExit();
+        return dir;
+    }
+
+    protected static File tempFile(Path dir, String name) {
+        File file = dir.resolve(name).toFile();
+        file.deleteOnExit();
+        return file;
+    }
+}
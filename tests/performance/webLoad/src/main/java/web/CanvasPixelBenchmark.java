@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package web;
+
+import javafx.application.Application;
+import javafx.scene.web.WebEngine;
+import javafx.stage.Stage;
+
+/**
+ * Measures canvas pixel manipulation the way image editors and heat maps
+ * do it: every animation frame a number of small tiles of a large canvas are
+ * read with getImageData, modified and written back with putImageData.
+ * Reports the average time per call and the frame rate.
+ *
+ * Usage: java web.CanvasPixelBenchmark [seconds] [tilesPerFrame] [tileSize]
+ */
+public class CanvasPixelBenchmark extends Benchmark {
+
+    private static final String PAGE = """
+            <html><body style="margin: 0">
+            <canvas id="c" width="1024" height="768"></canvas>
+            <script>
+            var ctx = document.getElementById('c').getContext('2d');
+            ctx.fillStyle = '#369';
+            ctx.fillRect(0, 0, 1024, 768);
+            var stats = { frames: 0, gets: 0, puts: 0, getTime: 0, putTime: 0 };
+            var running = true;
+            function frame(tiles, size) {
+                for (var i = 0; i < tiles; i++) {
+                    var x = Math.floor(Math.random() * (1024 - size));
+                    var y = Math.floor(Math.random() * (768 - size));
+                    var t0 = performance.now();
+                    var img = ctx.getImageData(x, y, size, size);
+                    var t1 = performance.now();
+                    var d = img.data;
+                    for (var j = 0; j < d.length; j += 4) {
+                        d[j] = (d[j] + 16) & 255;
+                    }
+                    var t2 = performance.now();
+                    ctx.putImageData(img, x, y);
+                    var t3 = performance.now();
+                    stats.gets++;
+                    stats.puts++;
+                    stats.getTime += t1 - t0;
+                    stats.putTime += t3 - t2;
+                }
+                stats.frames++;
+                if (running) {
+                    requestAnimationFrame(function() { frame(tiles, size); });
+                }
+            }
+            function result() {
+                running = false;
+                return [stats.frames, stats.gets, stats.getTime, stats.puts, stats.putTime].join(' ');
+            }
+            </script>
+            </body></html>
+            """;
+
+    @Override
+    protected void run(Stage stage) {
+        int seconds = intArg(0, 5);
+        int tiles = intArg(1, 16);
+        int size = intArg(2, 16);
+
+        WebEngine engine = showWebView(stage);
+        loadContent(engine, PAGE, () -> {
+            engine.executeScript("frame(" + tiles + ", " + size + ")");
+            runFrames(seconds, () -> { }, () -> report(engine, tiles, size));
+        });
+    }
+
+    private void report(WebEngine engine, int tiles, int size) {
+        double elapsed = elapsedSeconds();
+        String[] r = ((String) engine.executeScript("result()")).split(" ");
+        long frames = Long.parseLong(r[0]);
+        long gets = Long.parseLong(r[1]);
+        double getTime = Double.parseDouble(r[2]);
+        long puts = Long.parseLong(r[3]);
+        double putTime = Double.parseDouble(r[4]);
+        System.out.printf("%d frames in %.2fs (%.1f fps), %d tiles of %dx%d per frame\n",
+                frames, elapsed, frames / elapsed, tiles, size, size);
+        System.out.printf("getImageData: %d calls, %.3f ms per call\n",
+                gets, gets > 0 ? getTime / gets : 0.0);
+        System.out.printf("putImageData: %d calls, %.3f ms per call\n",
+                puts, puts > 0 ? putTime / puts : 0.0);
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package web;
+
+import com.sun.webkit.WebPage;
+import com.sun.webkit.perf.PerfCounters;
+import javafx.application.Application;
+import javafx.stage.Stage;
+
+/**
+ * Measures how many texture pixels are repainted per frame while a small
+ * composited element spins on top of a large static page. Ideally only the
+ * tiles covered by the animated layer are touched, textures are reused
+ * rather than reallocated, and only the damaged part of the page is painted.
+ *
+ * Usage: java --add-exports javafx.web/com.sun.webkit=ALL-UNNAMED
+ *        web.CompositedAnimationBenchmark [seconds] [tileSize]
+ */
+public class CompositedAnimationBenchmark extends Benchmark {
+
+    private static final String PAGE = """
+            <html><head><style>
+            body { margin: 0; font: 14px sans-serif; }
+            #spinner {
+                position: fixed; left: 40px; top: 40px; width: 64px; height: 64px;
+                background: linear-gradient(45deg, #36c, #c63); border-radius: 8px;
+                will-change: transform; animation: spin 1s linear infinite;
+            }
+            @keyframes spin { to { transform: rotate(360deg); } }
+            </style></head><body>
+            <div id="spinner"></div>
+            <script>
+            for (var i = 0; i < 400; i++) {
+                var p = document.createElement('p');
+                p.textContent = 'Static paragraph ' + i + ' of the page behind the animation.';
+                document.body.appendChild(p);
+            }
+            </script>
+            </body></html>
+            """;
+
+    private PerfCounters start;
+    private long frames;
+
+    @Override
+    protected void run(Stage stage) {
+        int seconds = intArg(0, 5);
+
+        loadContent(showWebView(stage), PAGE, () -> {
+            start = WebPage.getPerfCounters();
+            runFrames(seconds, () -> frames++, this::report);
+        });
+    }
+
+    private void report() {
+        PerfCounters delta = WebPage.getPerfCounters().since(start);
+        double seconds = elapsedSeconds();
+        long pixels = delta.getCount("Compositing.textureUpdatedPixels");
+        System.out.printf("%d frames in %.2fs, tile size %s\n", frames, seconds,
+                System.getProperty("com.sun.webkit.compositingTileSize", "512"));
+        System.out.printf("texture pixels updated: %d (%.0f per frame)\n",
+                pixels, frames > 0 ? (double) pixels / frames : 0.0);
+        System.out.printf("textures allocated: %d, reused: %d\n",
+                delta.getCount("Compositing.textureAllocations"),
+                delta.getCount("Compositing.textureReuses"));
+        long paintedFrames = delta.getCount("Compositing.frames");
+        long paintedPixels = delta.getCount("Compositing.paintedPixels");
+        System.out.printf("page pixels painted: %d in %d frames (%.0f per frame)\n",
+                paintedPixels, paintedFrames,
+                paintedFrames > 0 ? (double) paintedPixels / paintedFrames : 0.0);
+    }
+
+    public static void main(String[] args) {
+        System.setProperty("com.sun.webkit.useCSS3D", "true");
+        System.setProperty("com.sun.webkit.perfCounters", "true");
+        if (args.length > 1) {
+            System.setProperty("com.sun.webkit.compositingTileSize", args[1]);
+        }
+        Application.launch(args);
+    }
+}
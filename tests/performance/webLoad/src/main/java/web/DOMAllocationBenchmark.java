@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package web;
+
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.web.WebEngine;
+import javafx.stage.Stage;
+
+/**
+ * Measures allocation heavy DOM workloads, modeled after the TodoMVC suites
+ * of Speedometer: items are added, toggled and removed, and a large table is
+ * rebuilt through innerHTML. The time per iteration is reported together with
+ * the resident set size of the process.
+ *
+ * To compare bmalloc with the system allocator, run the benchmark twice on
+ * the same build, the second time with the {@code Malloc=1} environment
+ * variable set, which makes bmalloc fall back to the system heap.
+ *
+ * Usage: java web.DOMAllocationBenchmark [iterations] [items]
+ */
+public class DOMAllocationBenchmark extends Benchmark {
+
+    private static final String PAGE = """
+            <html><body>
+            <ul id="list"></ul>
+            <div id="table"></div>
+            <script>
+            function run(items) {
+                var list = document.getElementById('list');
+                for (var i = 0; i < items; i++) {
+                    var li = document.createElement('li');
+                    var input = document.createElement('input');
+                    input.type = 'checkbox';
+                    li.appendChild(input);
+                    var label = document.createElement('label');
+                    label.textContent = 'Something to do ' + i;
+                    li.appendChild(label);
+                    list.appendChild(li);
+                }
+                var boxes = list.querySelectorAll('input');
+                for (var i = 0; i < boxes.length; i++) {
+                    boxes[i].checked = true;
+                    boxes[i].parentNode.className = 'completed';
+                }
+                while (list.firstChild) {
+                    list.removeChild(list.firstChild);
+                }
+                var html = ['<table>'];
+                for (var i = 0; i < items; i++) {
+                    html.push('<tr><td>' + i + '</td><td class="c' + (i % 7)
+                            + '">row ' + i + '</td><td><span>' + (i * 31)
+                            + '</span></td></tr>');
+                }
+                html.push('</table>');
+                var table = document.getElementById('table');
+                table.innerHTML = html.join('');
+                var height = table.offsetHeight;
+                table.innerHTML = '';
+                return height;
+            }
+            </script>
+            </body></html>
+            """;
+
+    @Override
+    protected void run(Stage stage) {
+        int iterations = intArg(0, 50);
+        int items = intArg(1, 2000);
+
+        WebEngine engine = new WebEngine();
+        loadContent(engine, PAGE, () -> {
+            run(engine, iterations, items);
+            Platform.exit();
+        });
+    }
+
+    private static void run(WebEngine engine, int iterations, int items) {
+        System.out.printf("allocator: %s, %d iterations of %d items\n",
+                System.getenv("Malloc") != null ? "system" : "default",
+                iterations, items);
+        long rssBefore = residentSetSize();
+        double total = 0;
+        double best = Double.MAX_VALUE;
+        for (int i = 0; i < iterations; i++) {
+            long t0 = System.nanoTime();
+            engine.executeScript("run(" + items + ")");
+            double millis = (System.nanoTime() - t0) / 1e6;
+            total += millis;
+            best = Math.min(best, millis);
+        }
+        long rssAfter = residentSetSize();
+        System.out.printf("mean %.2f ms, best %.2f ms per iteration\n",
+                total / iterations, best);
+        if (rssAfter >= 0) {
+            System.out.printf("resident set: %d KB before, %d KB after\n",
+                    rssBefore, rssAfter);
+        }
+    }
+
+    /**
+     * Returns the resident set size of the process in KB, or -1 if it can't
+     * be read on this platform.
+     */
+    private static long residentSetSize() {
+        try {
+            for (String line : Files.readAllLines(Path.of("/proc/self/status"))) {
+                if (line.startsWith("VmRSS:")) {
+                    return Long.parseLong(line.replaceAll("[^0-9]", ""));
+                }
+            }
+        } catch (IOException | NumberFormatException e) {
+            // Not available on this platform
+        }
+        return -1;
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package web;
+
+import java.awt.Color;
+import java.awt.GradientPaint;
+import java.awt.Graphics2D;
+import java.awt.image.BufferedImage;
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+import javafx.stage.Stage;
+import javax.imageio.ImageIO;
+
+/**
+ * Measures loading and decoding of a page that references many PNG and
+ * JPEG images. Every image is drawn to a canvas once the page has loaded,
+ * so the reported decode time covers full frame decoding rather than just
+ * the size sniffing done during layout.
+ *
+ * Usage: java web.ImagePageBenchmark [imageCount] [imageSize] [iterations]
+ */
+public class ImagePageBenchmark extends Benchmark {
+
+    private WebEngine engine;
+    private String pageUrl;
+    private int remaining;
+
+    @Override
+    protected void run(Stage stage) throws Exception {
+        int imageCount = intArg(0, 200);
+        int imageSize = intArg(1, 512);
+        remaining = intArg(2, 5);
+
+        Path dir = createTempDirectory("ImagePageBenchmark");
+        pageUrl = createPage(dir, imageCount, imageSize).toURI().toString();
+
+        engine = new WebEngine();
+        engine.titleProperty().addListener((ov, o, n) -> {
+            if (n == null || !n.startsWith("decoded ")) {
+                return;
+            }
+            double loadSeconds = elapsedSeconds();
+            System.out.printf("%d images of %dx%d: loaded and decoded in %.3fs (%s ms drawing)\n",
+                    imageCount, imageSize, imageSize, loadSeconds,
+                    n.substring("decoded ".length()));
+            loadNext();
+        });
+        engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+            if (n == Worker.State.FAILED) {
+                System.out.println(pageUrl + ": " + n);
+                loadNext();
+            }
+        });
+        loadNext();
+    }
+
+    private void loadNext() {
+        if (remaining-- == 0) {
+            Platform.exit();
+            return;
+        }
+        timedLoad(engine, pageUrl);
+    }
+
+    private static File createPage(Path dir, int imageCount, int imageSize) throws IOException {
+        StringBuilder html = new StringBuilder();
+        html.append("<html><body>\n");
+        for (int i = 0; i < imageCount; i++) {
+            String format = (i % 2 == 0) ? "png" : "jpg";
+            File image = tempFile(dir, "image" + i + "." + format);
+            ImageIO.write(createImage(i, imageSize), format.equals("png") ? "png" : "jpeg", image);
+            html.append("<img width=64 height=64 src='").append(image.getName()).append("'>\n");
+        }
+        html.append("<canvas id=c width=1 height=1></canvas>\n");
+        html.append("<script>\n");
+        html.append("window.onload = function() {\n");
+        html.append("  var ctx = document.getElementById('c').getContext('2d');\n");
+        html.append("  var t = Date.now();\n");
+        html.append("  var images = document.images;\n");
+        html.append("  for (var i = 0; i < images.length; i++) ctx.drawImage(images[i], 0, 0);\n");
+        html.append("  document.title = 'decoded ' + (Date.now() - t);\n");
+        html.append("};\n");
+        html.append("</script>\n");
+        html.append("</body></html>\n");
+
+        File page = tempFile(dir, "index.html");
+        Files.writeString(page.toPath(), html);
+        return page;
+    }
+
+    private static BufferedImage createImage(int seed, int size) {
+        BufferedImage image = new BufferedImage(size, size, BufferedImage.TYPE_INT_RGB);
+        Graphics2D g = image.createGraphics();
+        g.setPaint(new GradientPaint(0, 0, Color.getHSBColor(seed / 37f, 0.8f, 0.9f),
+                size, size, Color.getHSBColor(seed / 53f, 0.5f, 0.4f)));
+        g.fillRect(0, 0, size, size);
+        g.setColor(Color.WHITE);
+        g.drawString("image " + seed, size / 4, size / 2);
+        g.dispose();
+        return image;
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}
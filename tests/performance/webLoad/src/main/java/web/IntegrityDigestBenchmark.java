@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package web;
+
+import java.io.File;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.security.MessageDigest;
+import java.util.ArrayDeque;
+import java.util.Arrays;
+import java.util.Base64;
+import java.util.Queue;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.web.WebEngine;
+import javafx.stage.Stage;
+
+/**
+ * Measures WebKit's native message digests through subresource integrity
+ * checks. Each page loads one script, made of a single comment, whose
+ * integrity attribute has to be verified before it can run. The script
+ * reports back by changing the page title.
+ *
+ * Sizes double from 1 KB up to 64 MB, for each of SHA-256, SHA-384 and
+ * SHA-512.
+ *
+ * Usage: java web.IntegrityDigestBenchmark [iterations]
+ */
+public class IntegrityDigestBenchmark extends Benchmark {
+
+    private static final String[] ALGORITHMS = { "SHA-256", "SHA-384", "SHA-512" };
+
+    private record Run(String algorithm, int size, String url) { }
+
+    private final Queue<Run> runs = new ArrayDeque<>();
+    private WebEngine engine;
+    private Run current;
+
+    @Override
+    protected void run(Stage stage) throws Exception {
+        int iterations = intArg(0, 3);
+
+        Path dir = createTempDirectory("IntegrityDigestBenchmark");
+        for (int size = 1024; size <= 64 * 1024 * 1024; size *= 2) {
+            byte[] script = createScript(size);
+            File scriptFile = tempFile(dir, "script" + size + ".js");
+            Files.write(scriptFile.toPath(), script);
+
+            for (String algorithm : ALGORITHMS) {
+                String integrity = algorithm.replace("-", "").toLowerCase() + "-"
+                        + Base64.getEncoder().encodeToString(
+                                MessageDigest.getInstance(algorithm).digest(script));
+                File page = tempFile(dir, "page" + size + algorithm + ".html");
+                Files.writeString(page.toPath(),
+                        "<html><body><script src='" + scriptFile.getName()
+                        + "' integrity='" + integrity + "'"
+                        + " onload=\"document.title='loaded'\""
+                        + " onerror=\"document.title='failed'\"></script></body></html>");
+                for (int i = 0; i < iterations; i++) {
+                    runs.add(new Run(algorithm, size, page.toURI().toString()));
+                }
+            }
+        }
+
+        engine = new WebEngine();
+        engine.titleProperty().addListener((ov, o, n) -> {
+            if (n == null || current == null) {
+                return;
+            }
+            double millis = elapsedSeconds() * 1000;
+            System.out.printf("%s %9d bytes: %s in %.2f ms (%.1f MB/s)\n",
+                    current.algorithm(), current.size(), n, millis,
+                    current.size() / 1024.0 / 1024.0 / (millis / 1000));
+            loadNext();
+        });
+        loadNext();
+    }
+
+    private static byte[] createScript(int size) {
+        byte[] script = new byte[size];
+        Arrays.fill(script, (byte) 'x');
+        byte[] open = "/*".getBytes(StandardCharsets.US_ASCII);
+        byte[] close = "*/".getBytes(StandardCharsets.US_ASCII);
+        System.arraycopy(open, 0, script, 0, open.length);
+        System.arraycopy(close, 0, script, size - close.length, close.length);
+        return script;
+    }
+
+    private void loadNext() {
+        current = runs.poll();
+        if (current == null) {
+            Platform.exit();
+            return;
+        }
+        timedLoad(engine, current.url());
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package web;
+
+import java.util.Arrays;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.web.WebEngine;
+import javafx.stage.Stage;
+
+/**
+ * Runs compute heavy JavaScript kernels in a headless WebEngine and reports
+ * JetStream style scores: each kernel is timed over a number of iterations,
+ * the first iteration and the average of the worst four are reported along
+ * with the average of all iterations, and the overall score is the geometric
+ * mean of the per-kernel scores.
+ *
+ * To compare the JavaScriptCore tiers, run with the defaults (baseline JIT
+ * only), with {@code -Dcom.sun.webkit.useDFGJIT=true} and with
+ * {@code -Dcom.sun.webkit.useFTLJIT=true}.
+ *
+ * Usage: java web.JSComputeBenchmark [iterations]
+ */
+public class JSComputeBenchmark extends Benchmark {
+
+    private static final String[] KERNELS = { "nbody", "matmul", "sort", "hash", "grid" };
+
+    private static final String PAGE = """
+            <html><body><script>
+            function nbody() {
+                var bodies = [];
+                for (var i = 0; i < 64; i++) {
+                    bodies.push({ x: Math.cos(i), y: Math.sin(i), z: i / 64,
+                                  vx: 0, vy: 0, vz: 0, m: 1 + (i % 3) });
+                }
+                for (var step = 0; step < 200; step++) {
+                    for (var i = 0; i < bodies.length; i++) {
+                        var a = bodies[i];
+                        for (var j = i + 1; j < bodies.length; j++) {
+                            var b = bodies[j];
+                            var dx = a.x - b.x, dy = a.y - b.y, dz = a.z - b.z;
+                            var d2 = dx * dx + dy * dy + dz * dz + 0.01;
+                            var mag = 0.001 / (d2 * Math.sqrt(d2));
+                            a.vx -= dx * b.m * mag; a.vy -= dy * b.m * mag; a.vz -= dz * b.m * mag;
+                            b.vx += dx * a.m * mag; b.vy += dy * a.m * mag; b.vz += dz * a.m * mag;
+                        }
+                    }
+                    for (var i = 0; i < bodies.length; i++) {
+                        var a = bodies[i];
+                        a.x += 0.01 * a.vx; a.y += 0.01 * a.vy; a.z += 0.01 * a.vz;
+                    }
+                }
+                return bodies[0].x;
+            }
+
+            function matmul() {
+                var n = 96;
+                var a = new Float64Array(n * n), b = new Float64Array(n * n), c = new Float64Array(n * n);
+                for (var i = 0; i < n * n; i++) {
+                    a[i] = i % 7; b[i] = i % 5;
+                }
+                for (var i = 0; i < n; i++) {
+                    for (var k = 0; k < n; k++) {
+                        var aik = a[i * n + k];
+                        for (var j = 0; j < n; j++)
+                            c[i * n + j] += aik * b[k * n + j];
+                    }
+                }
+                return c[n * n - 1];
+            }
+
+            function sort() {
+                var rows = [];
+                var seed = 42;
+                for (var i = 0; i < 20000; i++) {
+                    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+                    rows.push({ id: i, value: seed % 1000, name: 'row' + seed });
+                }
+                rows.sort(function(a, b) {
+                    return a.value - b.value || (a.name < b.name ? -1 : a.name > b.name ? 1 : 0);
+                });
+                return rows[0].id;
+            }
+
+            function hash() {
+                var h = 0x811c9dc5;
+                for (var round = 0; round < 50; round++) {
+                    for (var i = 0; i < 10000; i++) {
+                        h ^= (i * round) & 0xff;
+                        h = Math.imul(h, 0x01000193) >>> 0;
+                        h = ((h << 13) | (h >>> 19)) >>> 0;
+                    }
+                }
+                return h;
+            }
+
+            function grid() {
+                var columns = ['open', 'high', 'low', 'close', 'volume'];
+                var data = [];
+                for (var i = 0; i < 5000; i++) {
+                    var row = {};
+                    for (var c = 0; c < columns.length; c++)
+                        row[columns[c]] = (i * (c + 3)) % 977;
+                    data.push(row);
+                }
+                var totals = {};
+                for (var c = 0; c < columns.length; c++) {
+                    var key = columns[c];
+                    totals[key] = data.filter(function(r) { return r[key] > 100; })
+                                      .map(function(r) { return r[key] * 1.5; })
+                                      .reduce(function(s, v) { return s + v; }, 0);
+                }
+                return JSON.stringify(totals).length;
+            }
+
+            function time(kernel) {
+                var t0 = performance.now();
+                window[kernel]();
+                return performance.now() - t0;
+            }
+            </script></body></html>
+            """;
+
+    @Override
+    protected void run(Stage stage) {
+        int iterations = intArg(0, 20);
+
+        WebEngine engine = new WebEngine();
+        loadContent(engine, PAGE, () -> {
+            run(engine, iterations);
+            Platform.exit();
+        });
+    }
+
+    private static void run(WebEngine engine, int iterations) {
+        String useFTLJIT = System.getProperty("com.sun.webkit.useFTLJIT", "false");
+        System.out.printf("useJIT=%s useDFGJIT=%s useFTLJIT=%s\n",
+                System.getProperty("com.sun.webkit.useJIT", "true"),
+                System.getProperty("com.sun.webkit.useDFGJIT", useFTLJIT),
+                useFTLJIT);
+        double logSum = 0;
+        for (String kernel : KERNELS) {
+            double[] times = new double[iterations];
+            for (int i = 0; i < iterations; i++) {
+                times[i] = ((Number) engine.executeScript("time('" + kernel + "')")).doubleValue();
+            }
+            double first = times[0];
+            double[] sorted = times.clone();
+            Arrays.sort(sorted);
+            int worstCount = Math.min(4, iterations);
+            double worst = 0;
+            for (int i = 0; i < worstCount; i++) {
+                worst += sorted[iterations - 1 - i];
+            }
+            worst /= worstCount;
+            double average = Arrays.stream(times).average().orElse(0);
+            // Scores follow JetStream: 5000 / time, geometric mean of the three.
+            double score = Math.cbrt((5000 / first) * (5000 / worst) * (5000 / average));
+            logSum += Math.log(score);
+            System.out.printf("%-8s first %8.2f ms, worst %8.2f ms, average %8.2f ms, score %8.2f\n",
+                    kernel, first, worst, average, score);
+        }
+        System.out.printf("score: %.2f\n", Math.exp(logSum / KERNELS.length));
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}
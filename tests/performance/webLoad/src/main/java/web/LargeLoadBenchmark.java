@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package web;
+
+import com.sun.net.httpserver.HttpServer;
+import java.io.File;
+import java.io.OutputStream;
+import java.net.InetSocketAddress;
+import java.nio.file.Files;
+import java.util.ArrayDeque;
+import java.util.Arrays;
+import java.util.Queue;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+import javafx.stage.Stage;
+
+/**
+ * Measures how fast large resources are delivered to WebKit, over both
+ * the http (HTTP2Loader) and the file (URLLoader) loaders.
+ *
+ * Usage: java web.LargeLoadBenchmark [sizeInMB] [iterations]
+ */
+public class LargeLoadBenchmark extends Benchmark {
+
+    private final Queue<String> urls = new ArrayDeque<>();
+    private HttpServer server;
+    private WebEngine engine;
+
+    @Override
+    protected void run(Stage stage) throws Exception {
+        int megabytes = intArg(0, 64);
+        int iterations = intArg(1, 5);
+
+        byte[] payload = new byte[megabytes * 1024 * 1024];
+        Arrays.fill(payload, (byte) 'x');
+
+        server = HttpServer.create(new InetSocketAddress("localhost", 0), 0);
+        server.createContext("/", exchange -> {
+            exchange.getResponseHeaders().add("Content-Type", "text/plain");
+            exchange.sendResponseHeaders(200, payload.length);
+            try (OutputStream os = exchange.getResponseBody()) {
+                os.write(payload);
+            }
+        });
+        server.start();
+
+        File file = File.createTempFile("LargeLoadBenchmark", ".txt");
+        file.deleteOnExit();
+        Files.write(file.toPath(), payload);
+
+        String httpUrl = "http://localhost:" + server.getAddress().getPort() + "/";
+        for (int i = 0; i < iterations; i++) {
+            urls.add(httpUrl);
+            urls.add(file.toURI().toString());
+        }
+
+        engine = new WebEngine();
+        engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+            if (n == Worker.State.SUCCEEDED || n == Worker.State.FAILED) {
+                double seconds = elapsedSeconds();
+                System.out.printf("%s: %s %dMB in %.3fs (%.1f MB/s)\n",
+                        engine.getLocation(), n, megabytes, seconds,
+                        megabytes / seconds);
+                loadNext();
+            }
+        });
+        loadNext();
+    }
+
+    private void loadNext() {
+        String url = urls.poll();
+        if (url == null) {
+            server.stop(0);
+            Platform.exit();
+            return;
+        }
+        timedLoad(engine, url);
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}
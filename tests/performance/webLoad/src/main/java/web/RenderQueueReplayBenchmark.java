@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package web;
+
+import com.sun.webkit.graphics.RenderQueueRecorder;
+import com.sun.webkit.graphics.RenderQueueReplay;
+import java.io.File;
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.List;
+import javafx.animation.PauseTransition;
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.concurrent.Worker;
+import javafx.scene.web.WebEngine;
+import javafx.stage.Stage;
+import javafx.util.Duration;
+
+/**
+ * Records the render queue buffers produced while a page loads and settles,
+ * then replays them into an offscreen image to time the graphics context
+ * per primitive, independently of layout, script and network.
+ *
+ * Usage: java --add-exports javafx.web/com.sun.webkit.graphics=ALL-UNNAMED
+ *        web.RenderQueueReplayBenchmark record url file [seconds]
+ *        web.RenderQueueReplayBenchmark replay file [iterations] [width] [height]
+ */
+public class RenderQueueReplayBenchmark extends Benchmark {
+
+    @Override
+    protected void run(Stage stage) throws Exception {
+        if (argCount() >= 3 && arg(0).equals("record")) {
+            record(stage, arg(1), new File(arg(2)), intArg(3, 2));
+        } else if (argCount() >= 2 && arg(0).equals("replay")) {
+            replay(new File(arg(1)), intArg(2, 20), intArg(3, 1024), intArg(4, 768));
+            Platform.exit();
+        } else {
+            System.out.println("Usage: RenderQueueReplayBenchmark record url file [seconds]");
+            System.out.println("       RenderQueueReplayBenchmark replay file [iterations] [width] [height]");
+            Platform.exit();
+        }
+    }
+
+    private void record(Stage stage, String url, File file, int seconds) throws IOException {
+        WebEngine engine = showWebView(stage);
+
+        RenderQueueRecorder.start(file);
+        engine.getLoadWorker().stateProperty().addListener((ov, o, n) -> {
+            if (n == Worker.State.SUCCEEDED || n == Worker.State.FAILED) {
+                System.out.println("page: " + n);
+                // Let animations and late images settle into the recording
+                PauseTransition settle = new PauseTransition(Duration.seconds(seconds));
+                settle.setOnFinished(e -> {
+                    try {
+                        int buffers = RenderQueueRecorder.stop();
+                        System.out.printf("%d buffers, %d bytes recorded to %s\n",
+                                buffers, file.length(), file);
+                    } catch (IOException ex) {
+                        ex.printStackTrace();
+                    }
+                    Platform.exit();
+                });
+                settle.play();
+            }
+        });
+        engine.load(url);
+    }
+
+    private void replay(File file, int iterations, int width, int height) throws IOException {
+        RenderQueueReplay replay = RenderQueueReplay.load(file);
+        System.out.printf("%d buffers, %d objects not recorded\n",
+                replay.getBufferCount(), replay.getUnsupportedRefCount());
+
+        // Warm up the decoder and the pipeline before measuring
+        replay.run(width, height, Math.max(1, iterations / 4));
+        long t0 = System.nanoTime();
+        long[][] profile = replay.run(width, height, iterations);
+        double totalMs = (System.nanoTime() - t0) / 1e6;
+
+        String[] names = RenderQueueReplay.getOpcodeNames();
+        List<Integer> ops = new ArrayList<>();
+        for (int op = 0; op < profile.length; op++) {
+            if (profile[op][RenderQueueReplay.COUNT] > 0) {
+                ops.add(op);
+            }
+        }
+        ops.sort((a, b) -> Long.compare(profile[b][RenderQueueReplay.TIME],
+                                        profile[a][RenderQueueReplay.TIME]));
+        System.out.printf("%-28s %10s %12s %10s %8s\n",
+                "opcode", "calls/run", "ms/run", "avg us", "failed");
+        for (int op : ops) {
+            long[] p = profile[op];
+            System.out.printf("%-28s %10d %12.2f %10.2f %8d\n",
+                    names[op], p[RenderQueueReplay.COUNT] / iterations,
+                    p[RenderQueueReplay.TIME] / 1e6 / iterations,
+                    p[RenderQueueReplay.TIME] / 1e3 / p[RenderQueueReplay.COUNT],
+                    p[RenderQueueReplay.FAILURES] / iterations);
+        }
+        System.out.printf("%.2f ms per replay, including readback\n", totalMs / iterations);
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}
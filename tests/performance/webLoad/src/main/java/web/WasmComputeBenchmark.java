@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.  Oracle designates this
+ * particular file as subject to the "Classpath" exception as provided
+ * by Oracle in the LICENSE file that accompanied this code.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package web;
+
+import javafx.application.Application;
+import javafx.application.Platform;
+import javafx.scene.web.WebEngine;
+import javafx.stage.Stage;
+
+/**
+ * Runs the same integer kernel compiled to WebAssembly and written in
+ * JavaScript in a headless WebEngine, and reports the time per call of
+ * each as the WebAssembly code tiers up from BBQ to OMG.
+ *
+ * Usage: java web.WasmComputeBenchmark [iterations] [n]
+ */
+public class WasmComputeBenchmark extends Benchmark {
+
+    // sumOfSquares(n): the wrapping i32 sum of i * i for i in 1..n
+    private static final String PAGE = """
+            <html><body><script>
+            var wasm = typeof WebAssembly === 'object' ? new WebAssembly.Instance(new WebAssembly.Module(new Uint8Array([
+                0x00,0x61,0x73,0x6d,0x01,0x00,0x00,0x00,0x01,0x06,0x01,0x60,0x01,0x7f,0x01,0x7f,
+                0x03,0x02,0x01,0x00,0x07,0x10,0x01,0x0c,0x73,0x75,0x6d,0x4f,0x66,0x53,0x71,0x75,
+                0x61,0x72,0x65,0x73,0x00,0x00,0x0a,0x26,0x01,0x24,0x01,0x01,0x7f,0x02,0x40,0x03,
+                0x40,0x20,0x00,0x45,0x0d,0x01,0x20,0x01,0x20,0x00,0x20,0x00,0x6c,0x6a,0x21,0x01,
+                0x20,0x00,0x41,0x01,0x6b,0x21,0x00,0x0c,0x00,0x0b,0x0b,0x20,0x01,0x0b]))).exports : null;
+            function jsSumOfSquares(n) {
+                var acc = 0;
+                for (; n; n--) acc = (acc + Math.imul(n, n)) | 0;
+                return acc;
+            }
+            function time(f, n) {
+                var t0 = performance.now();
+                f(n);
+                return performance.now() - t0;
+            }
+            </script></body></html>
+            """;
+
+    @Override
+    protected void run(Stage stage) {
+        int iterations = intArg(0, 30);
+        int n = intArg(1, 10_000_000);
+
+        WebEngine engine = new WebEngine();
+        loadContent(engine, PAGE, () -> {
+            run(engine, iterations, n);
+            Platform.exit();
+        });
+    }
+
+    private static void run(WebEngine engine, int iterations, int n) {
+        if (!(Boolean) engine.executeScript("wasm !== null")) {
+            System.out.println("WebAssembly is not available");
+            return;
+        }
+        for (int i = 0; i < iterations; i++) {
+            double wasm = ((Number) engine.executeScript("time(wasm.sumOfSquares, " + n + ")")).doubleValue();
+            double js = ((Number) engine.executeScript("time(jsSumOfSquares, " + n + ")")).doubleValue();
+            System.out.printf("%3d: wasm %8.2f ms, js %8.2f ms\n", i, wasm, js);
+        }
+    }
+
+    public static void main(String[] args) {
+        Application.launch(args);
+    }
+}